@@ -0,0 +1,306 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  Arduino.cpp (native host build)
+  Virtual clock, pin stubs and the Teensy core's random number generator.
+*/
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include "Arduino.h"
+
+#define HOST_PIN_COUNT  64
+#define HOST_SERIAL_BUFFER  4096
+
+static uint64_t Virtual_Micros = 0;
+static uint32_t Random_Seed = 0;
+static void (* Pin_Interrupts[HOST_PIN_COUNT])(void) = {0};
+static uint8_t Pin_Levels[HOST_PIN_COUNT] = {0};
+static uint8_t Serial_Input[HOST_SERIAL_BUFFER];
+static uint32_t Serial_Input_Head = 0; // Next byte read()
+static uint32_t Serial_Input_Tail = 0; // Next byte written by hostSerialInject()
+static int Serial_Pty = -1; // Master side of the pseudo-terminal, once opened
+static int Serial_Pty_Peer = -1; // Kept open so the master doesn't read end of file between peers
+
+HostSerial Serial;
+
+uint32_t millis()
+{
+  return (uint32_t)(Virtual_Micros / 1000);
+}
+
+uint32_t micros()
+{
+  return (uint32_t)Virtual_Micros;
+}
+
+void delay(uint32_t ms)
+{
+  Virtual_Micros += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(uint32_t us)
+{
+  Virtual_Micros += us;
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  if(pin < HOST_PIN_COUNT)
+  {
+    Pin_Levels[pin] = val ? HIGH : LOW;
+  }
+}
+
+int digitalRead(uint8_t pin)
+{
+  return pin < HOST_PIN_COUNT ? Pin_Levels[pin] : LOW;
+}
+
+int analogRead(uint8_t pin)
+{
+  (void)pin;
+  return 0;
+}
+
+void attachInterrupt(uint8_t pin, void (*function)(void), int mode)
+{
+  (void)mode;
+  if(pin < HOST_PIN_COUNT)
+  {
+    Pin_Interrupts[pin] = function;
+  }
+}
+
+void randomSeed(uint32_t newseed)
+{
+  if(newseed > 0)
+  {
+    Random_Seed = newseed;
+  }
+}
+
+/*
+  The minimal standard generator used by the Teensy 3.x core (and avr-libc).
+  Kept identical so that host runs draw the same sequences as the board does
+  for the same seed.
+*/
+static int32_t nextRandom()
+{
+  int32_t hi, lo, x;
+
+  x = Random_Seed;
+  if(x == 0)
+  {
+    x = 123459876;
+  }
+  hi = x / 127773;
+  lo = x % 127773;
+  x = 16807 * lo - 2836 * hi;
+  if(x < 0)
+  {
+    x += 0x7FFFFFFF;
+  }
+  Random_Seed = x;
+  return x;
+}
+
+uint32_t random(uint32_t howbig)
+{
+  if(howbig == 0)
+  {
+    return 0;
+  }
+  return nextRandom() % howbig;
+}
+
+int32_t random(int32_t howsmall, int32_t howbig)
+{
+  if(howsmall >= howbig)
+  {
+    return howsmall;
+  }
+  int32_t diff = howbig - howsmall;
+  return random((uint32_t)diff) + howsmall;
+}
+
+void hostAdvanceMicros(uint32_t us)
+{
+  Virtual_Micros += us;
+}
+
+void hostSetMicros(uint64_t us)
+{
+  Virtual_Micros = us;
+}
+
+void hostTriggerInterrupt(uint8_t pin)
+{
+  if(pin < HOST_PIN_COUNT && Pin_Interrupts[pin])
+  {
+    Pin_Interrupts[pin]();
+  }
+}
+
+//Moves whatever the pseudo-terminal has waiting into the input buffer, as far as it fits.
+static void pumpSerialPty()
+{
+  if(Serial_Pty < 0)
+  {
+    return;
+  }
+  uint8_t data[256];
+  uint32_t space = (Serial_Input_Head + HOST_SERIAL_BUFFER - Serial_Input_Tail - 1) % HOST_SERIAL_BUFFER;
+  ssize_t length = ::read(Serial_Pty, data, space < sizeof(data) ? space : sizeof(data));
+  if(length > 0)
+  {
+    hostSerialInject(data, length);
+  }
+}
+
+static size_t writeSerial(const void *data, size_t length)
+{
+  if(Serial_Pty < 0)
+  {
+    return fwrite(data, 1, length, stdout);
+  }
+  ssize_t written = ::write(Serial_Pty, data, length);
+  return written > 0 ? written : 0;
+}
+
+int HostSerial::available()
+{
+  pumpSerialPty();
+  return (Serial_Input_Tail - Serial_Input_Head) % HOST_SERIAL_BUFFER;
+}
+
+int HostSerial::read()
+{
+  if(Serial_Input_Head == Serial_Input_Tail)
+  {
+    return -1;
+  }
+  uint8_t c = Serial_Input[Serial_Input_Head];
+  Serial_Input_Head = (Serial_Input_Head + 1) % HOST_SERIAL_BUFFER;
+  return c;
+}
+
+//Like the Teensy core's, it doesn't wait for bytes that haven't arrived yet.
+size_t HostSerial::readBytes(char *buffer, size_t length)
+{
+  size_t count = 0;
+  while(count < length && Serial_Input_Head != Serial_Input_Tail)
+  {
+    buffer[count++] = Serial_Input[Serial_Input_Head];
+    Serial_Input_Head = (Serial_Input_Head + 1) % HOST_SERIAL_BUFFER;
+  }
+  return count;
+}
+
+//The same as one empty Teensy USB packet
+int HostSerial::availableForWrite()
+{
+  return 64;
+}
+
+size_t HostSerial::write(uint8_t c)
+{
+  return writeSerial(&c, 1);
+}
+
+size_t HostSerial::write(const uint8_t *buffer, size_t size)
+{
+  return writeSerial(buffer, size);
+}
+
+size_t HostSerial::print(const char *s)
+{
+  return writeSerial(s, strlen(s));
+}
+
+size_t HostSerial::println(const char *s)
+{
+  return print(s) + print("\r\n");
+}
+
+size_t HostSerial::print(long n)
+{
+  char text[24];
+  snprintf(text, sizeof(text), "%ld", n);
+  return print(text);
+}
+
+size_t HostSerial::println(long n)
+{
+  return print(n) + print("\r\n");
+}
+
+void hostSerialInject(const uint8_t *data, size_t length)
+{
+  for(size_t i = 0; i < length; i++)
+  {
+    uint32_t next = (Serial_Input_Tail + 1) % HOST_SERIAL_BUFFER;
+    if(next == Serial_Input_Head)
+    {
+      return;
+    }
+    Serial_Input[Serial_Input_Tail] = data[i];
+    Serial_Input_Tail = next;
+  }
+}
+
+const char * hostSerialOpenPty()
+{
+  int pty = posix_openpt(O_RDWR | O_NOCTTY);
+  if(pty < 0 || grantpt(pty) != 0 || unlockpt(pty) != 0)
+  {
+    return NULL;
+  }
+  const char *path = ptsname(pty);
+  int peer = path ? open(path, O_RDWR | O_NOCTTY) : -1;
+  if(peer < 0)
+  {
+    close(pty);
+    return NULL;
+  }
+
+  //Bytes have to pass through untouched, like they do over USB
+  struct termios settings;
+  tcgetattr(peer, &settings);
+  cfmakeraw(&settings);
+  tcsetattr(peer, TCSANOW, &settings);
+  fcntl(pty, F_SETFL, fcntl(pty, F_GETFL) | O_NONBLOCK);
+
+  Serial_Pty = pty;
+  Serial_Pty_Peer = peer;
+  return path;
+}
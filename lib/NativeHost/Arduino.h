@@ -0,0 +1,107 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  Arduino.h (native host build)
+  A minimal stand-in for the Teensy 3.x Arduino core so that the firmware in
+  src/ can be compiled and run on a desktop machine. Time is virtual: it only
+  moves when delay() is called or when the host harness advances it, which
+  keeps benchmark and simulation runs independent of the wall clock.
+*/
+
+#ifndef NATIVE_HOST_ARDUINO_H
+#define NATIVE_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define HIGH  1
+#define LOW   0
+
+#define INPUT         0
+#define OUTPUT        1
+#define INPUT_PULLUP  2
+
+#define RISING  3
+#define FALLING 2
+#define CHANGE  4
+
+#define digitalPinToInterrupt(p)  (p)
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*function)(void), int mode);
+
+// Same generator and overloads as the Teensy 3.x core. The zero argument
+// form is left to the C library so that it doesn't collide with POSIX random().
+void randomSeed(uint32_t newseed);
+uint32_t random(uint32_t howbig);
+int32_t random(int32_t howsmall, int32_t howbig);
+
+/*
+  The USB serial port. Output goes to stdout; input is whatever the host
+  harness queued with hostSerialInject(). Once hostSerialOpenPty() has been
+  called, both go through a pseudo-terminal instead, so another program can
+  talk to the firmware the way a PC talks to the board.
+*/
+class HostSerial
+{
+public:
+  void begin(uint32_t baud) { (void)baud; }
+  int available();
+  int read();
+  size_t readBytes(char *buffer, size_t length);
+  int availableForWrite();
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buffer, size_t size);
+  size_t print(const char *s);
+  size_t println(const char *s);
+  size_t print(long n);
+  size_t println(long n);
+  operator bool() { return true; }
+};
+
+extern HostSerial Serial;
+
+/*
+  Host harness controls. These don't exist on the Teensy.
+*/
+void hostSerialInject(const uint8_t *data, size_t length); // Queues bytes for Serial.read()
+const char * hostSerialOpenPty(); // Moves Serial onto a new raw pseudo-terminal. Returns the path to open its other end at, or NULL
+void hostAdvanceMicros(uint32_t us); // Moves the virtual clock forward
+void hostSetMicros(uint64_t us); // Jumps the virtual clock to an absolute time
+void hostTriggerInterrupt(uint8_t pin); // Calls the handler given to attachInterrupt()
+
+#endif
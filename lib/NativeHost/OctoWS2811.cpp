@@ -0,0 +1,179 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  OctoWS2811.cpp (native host build)
+  The pixel packing below follows PJRC's OctoWS2811 1.4 (MIT licensed,
+  Copyright (c) 2013 Paul Stoffregen) so encoded buffers match the board.
+*/
+
+#include "OctoWS2811.h"
+#include "wire_timing.h"
+
+uint16_t OctoWS2811::stripLen;
+void * OctoWS2811::frameBuffer;
+void * OctoWS2811::drawBuffer;
+uint8_t OctoWS2811::params;
+
+static uint32_t update_started_at = 0;
+static uint32_t update_length_us = 0;
+
+uint32_t OctoWS2811::setPixelCalls = 0;
+uint32_t OctoWS2811::getPixelCalls = 0;
+uint32_t OctoWS2811::showCalls = 0;
+
+OctoWS2811::OctoWS2811(uint32_t numPerStrip, void *frameBuf, void *drawBuf, uint8_t config)
+{
+  stripLen = numPerStrip;
+  frameBuffer = frameBuf;
+  drawBuffer = drawBuf;
+  params = config;
+}
+
+void OctoWS2811::begin(void)
+{
+  uint32_t bufsize = stripLen * 24;
+
+  memset(frameBuffer, 0, bufsize);
+  if(drawBuffer)
+  {
+    memset(drawBuffer, 0, bufsize);
+  }
+  else
+  {
+    drawBuffer = frameBuffer;
+  }
+}
+
+void OctoWS2811::resetCounters(void)
+{
+  setPixelCalls = 0;
+  getPixelCalls = 0;
+  showCalls = 0;
+}
+
+/*
+  The transfer is modelled on the virtual clock by wire_timing.h: 24 bits per
+  LED at the configured bit rate, followed by the 300 us the real library
+  waits for the strand to latch.
+*/
+int OctoWS2811::busy(void)
+{
+  return micros() - update_started_at < update_length_us;
+}
+
+void OctoWS2811::show(void)
+{
+  showCalls++;
+  while(busy())
+  {
+    delayMicroseconds(1);
+  }
+  if(drawBuffer != frameBuffer)
+  {
+    memcpy(frameBuffer, drawBuffer, stripLen * 24);
+  }
+  update_started_at = micros();
+  update_length_us = wireFrameUs(stripLen, params);
+}
+
+void OctoWS2811::setPixel(uint32_t num, int color)
+{
+  uint32_t strip, offset, mask;
+  uint8_t bit, *p;
+
+  setPixelCalls++;
+  switch(params & 7)
+  {
+    case WS2811_RBG:
+      color = (color&0xFF0000) | ((color<<8)&0x00FF00) | ((color>>8)&0x0000FF);
+      break;
+    case WS2811_GRB:
+      color = ((color<<8)&0xFF0000) | ((color>>8)&0x00FF00) | (color&0x0000FF);
+      break;
+    case WS2811_GBR:
+      color = ((color<<8)&0xFFFF00) | ((color>>16)&0x0000FF);
+      break;
+    default:
+      break;
+  }
+  strip = num / stripLen;
+  offset = num % stripLen;
+  // The Cortex-M4 only uses the bottom byte of a register shift amount, and
+  // the result is truncated to a byte; reproduce that for out of range indices.
+  bit = (strip & 0xFF) < 8 ? (1 << (strip & 0xFF)) : 0;
+  p = ((uint8_t *)drawBuffer) + offset * 24;
+  for(mask = (1<<23); mask; mask >>= 1)
+  {
+    if(color & mask)
+    {
+      *p++ |= bit;
+    }
+    else
+    {
+      *p++ &= ~bit;
+    }
+  }
+}
+
+int OctoWS2811::getPixel(uint32_t num)
+{
+  uint32_t strip, offset, mask;
+  uint8_t bit, *p;
+  int color = 0;
+
+  getPixelCalls++;
+  strip = num / stripLen;
+  offset = num % stripLen;
+  bit = (strip & 0xFF) < 8 ? (1 << (strip & 0xFF)) : 0;
+  p = ((uint8_t *)drawBuffer) + offset * 24;
+  for(mask = (1<<23); mask; mask >>= 1)
+  {
+    if(*p++ & bit)
+    {
+      color |= mask;
+    }
+  }
+  switch(params & 7)
+  {
+    case WS2811_RBG:
+      color = (color&0xFF0000) | ((color<<8)&0x00FF00) | ((color>>8)&0x0000FF);
+      break;
+    case WS2811_GRB:
+      color = ((color<<8)&0xFF0000) | ((color>>8)&0x00FF00) | (color&0x0000FF);
+      break;
+    case WS2811_GBR:
+      color = ((color<<8)&0xFFFF00) | ((color>>16)&0x0000FF);
+      break;
+    case WS2811_BRG:
+      color = ((color<<16)&0xFF0000) | ((color>>8)&0x00FFFF);
+      break;
+    case WS2811_BGR:
+      color = ((color<<16)&0xFF0000) | (color&0x00FF00) | ((color>>16)&0x0000FF);
+      break;
+    default:
+      break;
+  }
+  return color;
+}
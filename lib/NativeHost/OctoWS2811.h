@@ -0,0 +1,85 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  OctoWS2811.h (native host build)
+  A drop-in fake of PJRC's OctoWS2811 with the same public surface. Pixels are
+  stored in the same 24 bytes per LED, one bit per strip layout the real
+  library uses, so the cost of setPixel()/getPixel() on the host is
+  representative of the board. Nothing is transmitted; show() performs the
+  drawing buffer to frame buffer copy, and busy() reports the time the
+  transfer would take on the virtual clock.
+*/
+
+#ifndef OctoWS2811_h
+#define OctoWS2811_h
+
+#include <Arduino.h>
+
+#define WS2811_RGB	0
+#define WS2811_RBG	1
+#define WS2811_GRB	2
+#define WS2811_GBR	3
+#define WS2811_BRG	4
+#define WS2811_BGR	5
+
+#define WS2811_800kHz 0x00
+#define WS2811_400kHz 0x10
+#define WS2813_800kHz 0x20
+
+class OctoWS2811 {
+public:
+  OctoWS2811(uint32_t numPerStrip, void *frameBuf, void *drawBuf, uint8_t config = WS2811_GRB);
+  void begin(void);
+
+  void setPixel(uint32_t num, int color);
+  void setPixel(uint32_t num, uint8_t red, uint8_t green, uint8_t blue) {
+    setPixel(num, color(red, green, blue));
+  }
+  int getPixel(uint32_t num);
+
+  void show(void);
+  int busy(void);
+
+  int numPixels(void) {
+    return stripLen * 8;
+  }
+  int color(uint8_t red, uint8_t green, uint8_t blue) {
+    return (red << 16) | (green << 8) | blue;
+  }
+
+  // Host only: call counters for the benchmark runner
+  static uint32_t setPixelCalls;
+  static uint32_t getPixelCalls;
+  static uint32_t showCalls;
+  static void resetCounters(void);
+
+private:
+  static uint16_t stripLen;
+  static void *frameBuffer;
+  static void *drawBuffer;
+  static uint8_t params;
+};
+
+#endif
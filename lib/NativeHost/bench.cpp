@@ -0,0 +1,827 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  bench.cpp (native host build)
+  Frame cost benchmark. Each effect is run through loop(), the same path the
+  board takes. Under the default worst case load its stress() hook is called
+  before every frame so that it carries as many particles as it can hold; the
+  typical load leaves it alone. After a warm-up period the wall clock time
+  of every frame and how much of the render buffer it touched are recorded.
+*/
+
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <OctoWS2811.h>
+#include "blend.h"
+#include "config.h"
+#include "dither.h"
+#include "fixed.h"
+#include "frame.h"
+#include "gamma.h"
+#include "host.h"
+#include "rng.h"
+#include "transition.h"
+
+#define BENCH_WARMUP_FRAMES 600
+
+struct bench_result_s
+{
+  uint64_t total_ns;
+  uint64_t worst_ns;
+  uint64_t blocks_drawn;
+  uint64_t leds_encoded;
+  uint32_t frames;
+};
+
+static void benchEffect(uint32_t effect, uint32_t frames, bool worst_case, struct bench_result_s *result)
+{
+  memset(result, 0, sizeof(*result));
+  CurrentEffect = effect;
+  void (* stress)() = worst_case ? Effects[effect]->stress : NULL;
+
+  for(uint32_t frame = 0; frame < BENCH_WARMUP_FRAMES; frame++)
+  {
+    if(stress)
+    {
+      stress();
+    }
+    hostAdvanceMicros(1000000 / TARGET_FPS);
+    loop();
+  }
+
+  for(uint32_t frame = 0; frame < frames; frame++)
+  {
+    if(stress)
+    {
+      stress();
+    }
+    hostAdvanceMicros(1000000 / TARGET_FPS);
+    memset(&FrameStats, 0, sizeof(FrameStats)); //Left as is by frames that aren't drawn
+    uint64_t start = hostNanos();
+    loop();
+    uint64_t elapsed = hostNanos() - start;
+
+    result->total_ns += elapsed;
+    if(elapsed > result->worst_ns)
+    {
+      result->worst_ns = elapsed;
+    }
+    result->blocks_drawn += FrameStats.blocks_drawn;
+    result->leds_encoded += FrameStats.leds_encoded;
+    result->frames++;
+  }
+}
+
+int benchMain(int argc, char **argv)
+{
+  uint32_t frames = argc > 0 ? strtoul(argv[0], NULL, 0) : 10000;
+  bool worst_case = argc < 2 || strcmp(argv[1], "typical") != 0;
+  if(frames == 0)
+  {
+    fprintf(stderr, "bench: frames must be greater than 0\n");
+    return 1;
+  }
+
+  setup();
+  rngBegin(1);
+
+  printf("%-12s %12s %12s %14s %14s\n", "effect", "ns/frame", "worst ns", "drawn px/frm", "encoded/frm");
+  for(uint32_t effect = 0; effect < EffectCount; effect++)
+  {
+    struct bench_result_s result;
+    benchEffect(effect, frames, worst_case, &result);
+    printf("%-12s %12llu %12llu %14.1f %14.1f\n", Effects[effect]->name,
+      (unsigned long long)(result.total_ns / result.frames),
+      (unsigned long long)result.worst_ns,
+      (double)result.blocks_drawn * FRAME_BLOCK_SIZE / result.frames,
+      (double)result.leds_encoded / result.frames);
+  }
+  return 0;
+}
+
+/*
+  Encoder benchmark. Fills the render buffer with random colors, encodes it
+  with frameEncode() and with one OctoWS2811::setPixel() call per LED at its
+  mapped output position, and checks that both produce the same DMA buffer.
+  The setPixel() side gets its colors gamma corrected by frameOutputColor(),
+  outside of the timed section. Every other frame is encoded at a lower
+  brightness to check the scaling as well. Dithering is off for the check.
+*/
+int benchEncodeMain(int argc, char **argv)
+{
+  uint32_t frames = argc > 0 ? strtoul(argv[0], NULL, 0) : 2000;
+  if(frames == 0)
+  {
+    fprintf(stderr, "encode: frames must be greater than 0\n");
+    return 1;
+  }
+
+  static int encoded[Strand::framebuffer_words];
+  static int reference[Strand::framebuffer_words];
+  static uint32_t corrected[FRAME_PIXELS];
+  OctoWS2811 octo(Strand::leds_per_channel, reference, NULL, Strand::config);
+  octo.begin();
+  randomSeed(1);
+
+  bool dither = frameDither();
+  frameSetDither(false); //Dithered output depends on the frames before it; the reference can't follow that
+  uint64_t encode_ns = 0;
+  uint64_t set_pixel_ns = 0;
+  uint32_t mismatches = 0;
+  for(uint32_t frame = 0; frame < frames; frame++)
+  {
+    for(int led = 0; led < FRAME_PIXELS; led++)
+    {
+      Frame[led] = random(0x1000000);
+    }
+    frameSetBrightness(frame % 2 ? 96 : MASTER_BRIGHTNESS);
+    for(int led = 0; led < FRAME_PIXELS; led++)
+    {
+      corrected[led] = frameOutputColor(Frame[led]);
+    }
+
+    frameMarkAllDirty();
+    uint64_t start = hostNanos();
+    frameEncode(encoded);
+    encode_ns += hostNanos() - start;
+
+    start = hostNanos();
+    for(int led = 0; led < FRAME_PIXELS; led++)
+    {
+      octo.setPixel(framePhysicalIndex(led), corrected[led]);
+    }
+    set_pixel_ns += hostNanos() - start;
+
+    if(memcmp(encoded, reference, sizeof(encoded)) != 0)
+    {
+      mismatches++;
+    }
+  }
+  frameSetBrightness(MASTER_BRIGHTNESS);
+  frameSetDither(dither);
+
+  printf("%u LEDs over %u segments of %u, %u frames\n", Strand::leds, Strand::segments, Strand::leds_per_channel, frames);
+  printf("frameEncode()      %10llu ns/frame\n", (unsigned long long)(encode_ns / frames));
+  printf("setPixel() per LED %10llu ns/frame\n", (unsigned long long)(set_pixel_ns / frames));
+  printf("mismatched frames  %10u\n", mismatches);
+  return mismatches ? 1 : 0;
+}
+
+/*
+  Dithering benchmark. Times the dithering kernel against a plain 8 bit
+  table lookup over 8 outputs of 150 and of 600 LEDs, then frameEncode() with
+  dithering off and on for the configured strand. Last, it checks that the
+  dithered output of a few dim levels averages out to the level asked for.
+*/
+#define DITHER_BENCH_MAX_PIXELS (8 * 600)
+#define DITHER_BENCH_CHECK_FRAMES 256
+
+int benchDitherMain(int argc, char **argv)
+{
+  uint32_t frames = argc > 0 ? strtoul(argv[0], NULL, 0) : 2000;
+  if(frames == 0)
+  {
+    fprintf(stderr, "dither: frames must be greater than 0\n");
+    return 1;
+  }
+
+  static uint32_t colors[DITHER_BENCH_MAX_PIXELS];
+  static uint32_t out[DITHER_BENCH_MAX_PIXELS];
+  static uint8_t residue[DITHER_BENCH_MAX_PIXELS][3];
+  uint8_t lut8[256];
+  uint16_t lut16[256];
+  for(int value = 0; value < 256; value++)
+  {
+    lut8[value] = (Gamma_Table[value] * 255u + 32767) / 65535;
+    lut16[value] = ((uint32_t)Gamma_Table[value] * 255 << 8) / 65535;
+  }
+  randomSeed(1);
+  for(int pixel = 0; pixel < DITHER_BENCH_MAX_PIXELS; pixel++)
+  {
+    colors[pixel] = random(0x1000000);
+  }
+
+  const int sizes[] = {8 * 150, 8 * 600};
+  volatile uint32_t sink = 0; //Keeps the compiler from dropping the loops
+  printf("%-10s %14s %14s\n", "LEDs", "lookup ns/frm", "dither ns/frm");
+  for(uint32_t size = 0; size < sizeof(sizes) / sizeof(sizes[0]); size++)
+  {
+    uint64_t lookup_ns = 0, dither_ns = 0;
+    for(uint32_t frame = 0; frame < frames; frame++)
+    {
+      uint64_t start = hostNanos();
+      for(int pixel = 0; pixel < sizes[size]; pixel++)
+      {
+        uint32_t color = colors[pixel];
+        out[pixel] = (lut8[(color >> 16) & 0xFF] << 16) | (lut8[(color >> 8) & 0xFF] << 8) | lut8[color & 0xFF];
+      }
+      lookup_ns += hostNanos() - start;
+      sink += out[frame % sizes[size]];
+
+      start = hostNanos();
+      for(int pixel = 0; pixel < sizes[size]; pixel++)
+      {
+        out[pixel] = ditherColor(colors[pixel], lut16, residue[pixel]);
+      }
+      dither_ns += hostNanos() - start;
+      sink += out[frame % sizes[size]];
+    }
+    printf("%-10d %14llu %14llu\n", sizes[size], (unsigned long long)(lookup_ns / frames), (unsigned long long)(dither_ns / frames));
+  }
+
+  static int encoded[Strand::framebuffer_words];
+  bool dither = frameDither();
+  for(int pass = 0; pass < 2; pass++)
+  {
+    frameSetDither(pass == 1);
+    uint64_t encode_ns = 0;
+    for(uint32_t frame = 0; frame < frames; frame++)
+    {
+      Frame[random(FRAME_PIXELS)] = random(0x1000000);
+      frameMarkAllDirty();
+      uint64_t start = hostNanos();
+      frameEncode(encoded);
+      encode_ns += hostNanos() - start;
+    }
+    printf("frameEncode(), %u LEDs, dithering %-3s %8llu ns/frame\n", STRAND_LENGTH, pass ? "on" : "off", (unsigned long long)(encode_ns / frames));
+  }
+  frameSetDither(dither);
+
+  //Average each dim level over a run of frames; it should land within a step of the 8.8 level asked for
+  int worst_error = 0;
+  for(int value = 1; value < 64; value++)
+  {
+    uint8_t check_residue[3] = {0};
+    uint32_t sum = 0;
+    for(int frame = 0; frame < DITHER_BENCH_CHECK_FRAMES; frame++)
+    {
+      sum += ditherColor(value, lut16, check_residue) & 0xFF;
+    }
+    int error = abs((int)(sum * 256 / DITHER_BENCH_CHECK_FRAMES) - (int)lut16[value]);
+    if(error > worst_error)
+    {
+      worst_error = error;
+    }
+  }
+  printf("worst average error over %d frames: %d/256 of a level\n", DITHER_BENCH_CHECK_FRAMES, worst_error);
+  return worst_error > 256 ? 1 : 0;
+}
+
+/*
+  Blend benchmark. Checks every blend mode against a plain per-channel
+  version for every pair of channel values, then times the add and max spans
+  against that per-channel code over 8 outputs of 600 LEDs. The host build
+  runs the SWAR versions; the board uses the DSP instructions instead.
+*/
+#define BLEND_BENCH_PIXELS (8 * 600)
+
+static uint32_t referenceChannel(int mode, uint32_t a, uint32_t b)
+{
+  switch(mode)
+  {
+    case 0: return a + b > 255 ? 255 : a + b;
+    case 1: return a > b ? a - b : 0;
+    case 2: return a > b ? a : b;
+    case 3: return a < b ? a : b;
+    case 4: return (a + b) / 2;
+    default: return (a * b + 127) / 255;
+  }
+}
+
+static uint32_t blendMode(int mode, uint32_t a, uint32_t b)
+{
+  switch(mode)
+  {
+    case 0: return blendAdd(a, b);
+    case 1: return blendSubtract(a, b);
+    case 2: return blendMax(a, b);
+    case 3: return blendMin(a, b);
+    case 4: return blendAverage(a, b);
+    default: return blendMultiply(a, b);
+  }
+}
+
+int benchBlendMain(int argc, char **argv)
+{
+  uint32_t frames = argc > 0 ? strtoul(argv[0], NULL, 0) : 2000;
+  if(frames == 0)
+  {
+    fprintf(stderr, "blend: frames must be greater than 0\n");
+    return 1;
+  }
+
+  static const char * const mode_names[] = {"add", "subtract", "max", "min", "average", "multiply"};
+  uint32_t mismatches = 0;
+  for(int mode = 0; mode < 6; mode++)
+  {
+    for(uint32_t a = 0; a < 256; a++)
+    {
+      for(uint32_t b = 0; b < 256; b++)
+      {
+        //Each channel gets a different pair, so carries leaking between bytes show up
+        uint32_t x = (a << 16) | (b << 8) | (255 - a);
+        uint32_t y = (b << 16) | (a << 8) | (255 - b);
+        uint32_t expected = (referenceChannel(mode, a, b) << 16) | (referenceChannel(mode, b, a) << 8) | referenceChannel(mode, 255 - a, 255 - b);
+        if(blendMode(mode, x, y) != expected)
+        {
+          mismatches++;
+        }
+      }
+    }
+  }
+  for(uint32_t value = 0; value < 256; value++)
+  {
+    //Fully opaque and fully transparent have to be exact
+    if(blendAlpha(value * 0x010101, 0x123456, 256) != 0x123456 || blendAlpha(value * 0x010101, 0x123456, 0) != value * 0x010101)
+    {
+      mismatches++;
+    }
+  }
+
+  static uint32_t dst[BLEND_BENCH_PIXELS];
+  static uint32_t src[BLEND_BENCH_PIXELS];
+  randomSeed(1);
+  for(int pixel = 0; pixel < BLEND_BENCH_PIXELS; pixel++)
+  {
+    src[pixel] = random(0x1000000);
+  }
+
+  uint64_t channel_ns = 0, add_ns = 0, max_ns = 0;
+  volatile uint32_t sink = 0; //Keeps the compiler from dropping the loops
+  for(uint32_t frame = 0; frame < frames; frame++)
+  {
+    memset(dst, 0x20, sizeof(dst));
+    uint64_t start = hostNanos();
+    for(int pixel = 0; pixel < BLEND_BENCH_PIXELS; pixel++)
+    {
+      uint32_t color = 0;
+      for(int shift = 0; shift < 24; shift += 8)
+      {
+        uint32_t sum = ((dst[pixel] >> shift) & 0xFF) + ((src[pixel] >> shift) & 0xFF);
+        color |= (sum > 255 ? 255 : sum) << shift;
+      }
+      dst[pixel] = color;
+    }
+    channel_ns += hostNanos() - start;
+    sink += dst[frame % BLEND_BENCH_PIXELS];
+
+    memset(dst, 0x20, sizeof(dst));
+    start = hostNanos();
+    blendAddSpan(dst, src, BLEND_BENCH_PIXELS);
+    add_ns += hostNanos() - start;
+    sink += dst[frame % BLEND_BENCH_PIXELS];
+
+    start = hostNanos();
+    blendMaxSpan(dst, src, BLEND_BENCH_PIXELS);
+    max_ns += hostNanos() - start;
+    sink += dst[frame % BLEND_BENCH_PIXELS];
+  }
+
+  printf("%d pixels, %u frames%s\n", BLEND_BENCH_PIXELS, frames, BLEND_DSP ? ", DSP instructions" : ", SWAR");
+  printf("per-channel add    %10llu ns/frame\n", (unsigned long long)(channel_ns / frames));
+  printf("blendAddSpan()     %10llu ns/frame\n", (unsigned long long)(add_ns / frames));
+  printf("blendMaxSpan()     %10llu ns/frame\n", (unsigned long long)(max_ns / frames));
+  printf("mismatches         %10u (%s", mismatches, mode_names[0]);
+  for(int mode = 1; mode < 6; mode++)
+  {
+    printf(", %s", mode_names[mode]);
+  }
+  printf(", alpha)\n");
+  return mismatches ? 1 : 0;
+}
+
+/*
+  Fixed point benchmark. Runs the candy cane spotlight falloff, the inner loop
+  of that effect, once with the float math it used to have and once with the
+  Q16.16 math it has now. The host has an FPU, so this mostly shows that the
+  fixed point version isn't slower and how far its output drifts; on the
+  Teensy the float version is a chain of soft-float calls.
+*/
+#define FIXED_BENCH_SPOTLIGHTS  8
+
+// As the effect had it: a float divide and multiply for every LED
+static int floatFalloff(float position, float intensity, int radius, int led)
+{
+  return -(intensity / (float)radius) * fabsf(led - position) + intensity;
+}
+
+static int floatFalloffSpan(float position, float intensity, int radius)
+{
+  int sum = 0;
+  for(int led = 0; led < STRAND_LENGTH; led++)
+  {
+    sum += floatFalloff(position, intensity, radius, led);
+  }
+  return sum;
+}
+
+// As the effect has it now: one integer divide per spotlight
+static int fixedFalloffSpan(fixed_t position, fixed_t intensity, int radius, int *out)
+{
+  int sum = 0;
+  fixed_t slope = intensity / radius;
+  for(int led = 0; led < STRAND_LENGTH; led++)
+  {
+    int brightness = fixedToInt(intensity - fixedMul(slope, fixedAbs(intToFixed(led) - position)));
+    if(out)
+    {
+      out[led] = brightness;
+    }
+    sum += brightness;
+  }
+  return sum;
+}
+
+int benchFixedMain(int argc, char **argv)
+{
+  uint32_t rounds = argc > 0 ? strtoul(argv[0], NULL, 0) : 20000;
+  if(rounds == 0)
+  {
+    fprintf(stderr, "fixed: rounds must be greater than 0\n");
+    return 1;
+  }
+
+  float float_position[FIXED_BENCH_SPOTLIGHTS], float_intensity[FIXED_BENCH_SPOTLIGHTS];
+  fixed_t fixed_position[FIXED_BENCH_SPOTLIGHTS], fixed_intensity[FIXED_BENCH_SPOTLIGHTS];
+  int radius[FIXED_BENCH_SPOTLIGHTS];
+  randomSeed(1);
+  for(int spotlight = 0; spotlight < FIXED_BENCH_SPOTLIGHTS; spotlight++)
+  {
+    fixed_position[spotlight] = random(0, intToFixed(STRAND_LENGTH));
+    fixed_intensity[spotlight] = random(0, intToFixed(80));
+    float_position[spotlight] = fixed_position[spotlight] / (float)FIXED_ONE;
+    float_intensity[spotlight] = fixed_intensity[spotlight] / (float)FIXED_ONE;
+    radius[spotlight] = random(8, 26);
+  }
+
+  volatile int sink = 0;
+  int worst_error = 0;
+  uint64_t float_ns = 0, fixed_ns = 0;
+  for(uint32_t round = 0; round < rounds; round++)
+  {
+    int float_sum = 0, fixed_sum = 0;
+    uint64_t start = hostNanos();
+    for(int spotlight = 0; spotlight < FIXED_BENCH_SPOTLIGHTS; spotlight++)
+    {
+      float_sum += floatFalloffSpan(float_position[spotlight], float_intensity[spotlight], radius[spotlight]);
+    }
+    float_ns += hostNanos() - start;
+
+    start = hostNanos();
+    for(int spotlight = 0; spotlight < FIXED_BENCH_SPOTLIGHTS; spotlight++)
+    {
+      fixed_sum += fixedFalloffSpan(fixed_position[spotlight], fixed_intensity[spotlight], radius[spotlight], NULL);
+    }
+    fixed_ns += hostNanos() - start;
+    sink = float_sum + fixed_sum;
+  }
+  (void)sink;
+
+  for(int spotlight = 0; spotlight < FIXED_BENCH_SPOTLIGHTS; spotlight++)
+  {
+    int fixed_out[STRAND_LENGTH];
+    fixedFalloffSpan(fixed_position[spotlight], fixed_intensity[spotlight], radius[spotlight], fixed_out);
+    for(int led = 0; led < STRAND_LENGTH; led++)
+    {
+      int error = abs(floatFalloff(float_position[spotlight], float_intensity[spotlight], radius[spotlight], led) - fixed_out[led]);
+      if(error > worst_error)
+      {
+        worst_error = error;
+      }
+    }
+  }
+
+  printf("%d spotlights x %u LEDs, %u rounds\n", FIXED_BENCH_SPOTLIGHTS, STRAND_LENGTH, rounds);
+  printf("float falloff   %10llu ns/round\n", (unsigned long long)(float_ns / rounds));
+  printf("Q16.16 falloff  %10llu ns/round\n", (unsigned long long)(fixed_ns / rounds));
+  printf("worst error     %10d brightness steps\n", worst_error);
+  return 0;
+}
+
+/*
+  Random number benchmark. Times a burst of particle spawns, each drawing
+  what a line dance line does (size, color, speed, spawn alarm), once with
+  the core's random() and the old speed round trip through thousandths, and
+  once with an rng.h stream. Then checks the streams: rngBetween() has to be
+  even over its range, and a stream has to replay the same draws for the
+  same seed and name, and different ones for another name.
+*/
+#define RNG_BENCH_BURST   160 //Lines a 1200 LED strand holds
+#define RNG_BENCH_BUCKETS 10
+
+int benchRngMain(int argc, char **argv)
+{
+  uint32_t bursts = argc > 0 ? strtoul(argv[0], NULL, 0) : 20000;
+  if(bursts == 0)
+  {
+    fprintf(stderr, "rng: bursts must be greater than 0\n");
+    return 1;
+  }
+
+  volatile int32_t sink = 0;
+  uint64_t random_ns = 0, rng_ns = 0;
+  struct rng_s rng;
+  randomSeed(1);
+  rngBegin(1);
+  rngStream(&rng, "bench");
+  for(uint32_t burst = 0; burst < bursts; burst++)
+  {
+    int32_t sum = 0;
+    uint64_t start = hostNanos();
+    for(int line = 0; line < RNG_BENCH_BURST; line++)
+    {
+      sum += random(5, 16);
+      sum += 0xFF << (random(0, 3) * 8);
+      sum += intToFixed(random(4 * 1000, 25 * 1000 + 1) / 1000);
+      sum += random(1000, 4001);
+    }
+    random_ns += hostNanos() - start;
+
+    start = hostNanos();
+    for(int line = 0; line < RNG_BENCH_BURST; line++)
+    {
+      sum += rngBetween(&rng, 5, 15);
+      sum += 0xFF << (rngBelow(&rng, 3) * 8);
+      sum += rngBetween(&rng, intToFixed(4), intToFixed(25));
+      sum += rngBetween(&rng, 1000, 4000);
+    }
+    rng_ns += hostNanos() - start;
+    sink = sum;
+  }
+  (void)sink;
+
+  uint32_t counts[RNG_BENCH_BUCKETS] = {0};
+  const uint32_t draws = 1000000;
+  for(uint32_t draw = 0; draw < draws; draw++)
+  {
+    counts[rngBetween(&rng, 0, RNG_BENCH_BUCKETS - 1)]++;
+  }
+  double worst_skew = 0;
+  for(int bucket = 0; bucket < RNG_BENCH_BUCKETS; bucket++)
+  {
+    double skew = fabs((double)counts[bucket] * RNG_BENCH_BUCKETS / draws - 1);
+    worst_skew = skew > worst_skew ? skew : worst_skew;
+  }
+
+  struct rng_s first, again, other;
+  rngBegin(7);
+  rngStream(&first, "line_dance");
+  rngStream(&other, "candy_cane");
+  rngBegin(7);
+  rngStream(&again, "line_dance");
+  uint32_t replay_mismatches = 0, other_matches = 0;
+  for(int draw = 0; draw < 1000; draw++)
+  {
+    uint32_t value = rngNext(&first);
+    replay_mismatches += value != rngNext(&again);
+    other_matches += value == rngNext(&other);
+  }
+
+  printf("%d spawns per burst, %u bursts\n", RNG_BENCH_BURST, bursts);
+  printf("random()        %10llu ns/burst\n", (unsigned long long)(random_ns / bursts));
+  printf("rng.h stream    %10llu ns/burst\n", (unsigned long long)(rng_ns / bursts));
+  printf("worst bucket    %10.2f%% off even, over %u draws\n", worst_skew * 100, draws);
+  printf("replay          %10s\n", replay_mismatches == 0 && other_matches == 0 ? "ok" : "FAILED");
+  return replay_mismatches == 0 && other_matches == 0 && worst_skew < 0.01 ? 0 : 1;
+}
+
+/*
+  Transition benchmark. Checks that every style gives the outgoing frame at
+  the start of a transition and the incoming one at its end, and times one
+  mix of the whole strand per style. Then switches loop() between every two
+  effects that can be faded, with both under their stress() load, and times
+  each frame of the transitions (TRANSITION_STYLE, over TRANSITION_MS)
+  against the frame period.
+
+  Each transition is also checked against the two effects run alone. Right
+  before the switch the process forks twice: one child keeps running the
+  outgoing effect, the other cuts to it through the stream effect (which
+  takes over without a transition) and then starts the incoming one. Both
+  send their active target after every frame down a pipe, and the targets
+  of the transition have to match them pixel for pixel: an effect drawing,
+  or decoding from update(), into the other's target shows up here.
+*/
+static const char * const Transition_Style_Names[] = {"crossfade", "wipe", "dissolve"};
+
+static void stressEffect(uint32_t effect)
+{
+  if(Effects[effect]->stress)
+  {
+    Effects[effect]->stress();
+  }
+}
+
+//Runs one frame of before, then frames frames of effect, writing effect's target to fd after each. Ends the process.
+static void runTransitionReference(int fd, uint32_t before, uint32_t effect, uint32_t frames)
+{
+  CurrentEffect = before;
+  if(before == effect)
+  {
+    stressEffect(effect);
+  }
+  hostAdvanceMicros(FRAME_PERIOD_US);
+  loop();
+  CurrentEffect = effect;
+  for(uint32_t frame = 0; frame < frames; frame++)
+  {
+    stressEffect(effect);
+    hostAdvanceMicros(FRAME_PERIOD_US);
+    loop();
+    if(write(fd, frameTargetPixels(ActiveTarget), FRAME_PIXELS * sizeof(uint32_t)) != FRAME_PIXELS * sizeof(uint32_t))
+    {
+      _exit(1);
+    }
+  }
+  _exit(0);
+}
+
+static pid_t forkTransitionReference(int *fd, uint32_t before, uint32_t effect, uint32_t frames)
+{
+  int ends[2];
+  if(pipe(ends) != 0)
+  {
+    return -1;
+  }
+  fflush(stdout);
+  pid_t child = fork();
+  if(child == 0)
+  {
+    close(ends[0]);
+    runTransitionReference(ends[1], before, effect, frames);
+  }
+  close(ends[1]);
+  *fd = ends[0];
+  return child;
+}
+
+//Reads the reference's frames and counts those that differ from frames, from the first one up to compared
+static uint32_t compareTransitionReference(int fd, pid_t child, const uint32_t *frames, uint32_t count, uint32_t compared)
+{
+  static uint32_t pixels[FRAME_PIXELS];
+  uint32_t mismatched = 0;
+  for(uint32_t frame = 0; frame < count; frame++)
+  {
+    size_t got = 0;
+    while(got < sizeof(pixels))
+    {
+      ssize_t length = read(fd, (uint8_t *)pixels + got, sizeof(pixels) - got);
+      if(length <= 0)
+      {
+        break;
+      }
+      got += length;
+    }
+    if(got < sizeof(pixels) || (frame < compared && memcmp(pixels, frames + frame * FRAME_PIXELS, sizeof(pixels)) != 0))
+    {
+      mismatched++;
+    }
+  }
+  close(fd);
+  int status;
+  waitpid(child, &status, 0);
+  return mismatched + (WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : 1);
+}
+
+int benchTransitionMain(int argc, char **argv)
+{
+  uint32_t frames = argc > 0 ? strtoul(argv[0], NULL, 0) : 10000;
+  if(frames == 0)
+  {
+    fprintf(stderr, "transition: frames must be greater than 0\n");
+    return 1;
+  }
+
+  static uint32_t from[FRAME_PIXELS], to[FRAME_PIXELS], out[FRAME_PIXELS];
+  struct rng_s rng;
+  rngBegin(1);
+  rngStream(&rng, "bench");
+  for(int led = 0; led < FRAME_PIXELS; led++)
+  {
+    from[led] = rngNext(&rng) & 0xFFFFFF;
+    to[led] = rngNext(&rng) & 0xFFFFFF;
+  }
+
+  bool ok = true;
+  printf("%-12s %12s %10s\n", "style", "ns/mix", "endpoints");
+  for(uint32_t style = 0; style < sizeof(Transition_Style_Names) / sizeof(Transition_Style_Names[0]); style++)
+  {
+    transitionMix(style, out, from, to, 0);
+    bool endpoints = memcmp(out, from, sizeof(out)) == 0;
+    transitionMix(style, out, from, to, TRANSITION_PROGRESS_ONE);
+    endpoints = endpoints && memcmp(out, to, sizeof(out)) == 0;
+    ok = ok && endpoints;
+
+    volatile uint32_t sink = 0;
+    uint64_t start = hostNanos();
+    for(uint32_t frame = 0; frame < frames; frame++)
+    {
+      transitionMix(style, out, from, to, (uint64_t)frame * TRANSITION_PROGRESS_ONE / frames);
+      sink = out[frame % FRAME_PIXELS];
+    }
+    (void)sink;
+    printf("%-12s %12llu %10s\n", Transition_Style_Names[style],
+      (unsigned long long)((hostNanos() - start) / frames), endpoints ? "ok" : "FAILED");
+  }
+
+#if TRANSITION_MS > 0
+  uint32_t stream = 0;
+  while(stream < EffectCount && !Effects[stream]->service)
+  {
+    stream++;
+  }
+  if(stream == EffectCount)
+  {
+    fprintf(stderr, "transition: no effect with a service() to cut through\n");
+    return 1;
+  }
+
+  //The outgoing effect is compared while it is sure to still be fading out, however the frame times round to milliseconds
+  const uint32_t transition_frames = TRANSITION_MS * TARGET_FPS / 1000 + 10;
+  const uint32_t fading_frames = (TRANSITION_MS - 1) * 1000 / FRAME_PERIOD_US - 1;
+  uint32_t *outgoing = (uint32_t *)malloc((size_t)transition_frames * FRAME_PIXELS * sizeof(uint32_t));
+  uint32_t *incoming = (uint32_t *)malloc((size_t)transition_frames * FRAME_PIXELS * sizeof(uint32_t));
+  setup();
+  printf("\n%s over %u ms, worst case load, %u us frame period\n", Transition_Style_Names[TRANSITION_STYLE], TRANSITION_MS, FRAME_PERIOD_US);
+  printf("%-26s %12s %12s %9s %9s\n", "transition", "ns/frame", "worst ns", "outgoing", "incoming");
+  for(uint32_t first = 0; first < EffectCount; first++)
+  {
+    for(uint32_t second = 0; second < EffectCount; second++)
+    {
+      if(first == second || Effects[first]->service || Effects[second]->service)
+      {
+        continue;
+      }
+      rngBegin(1);
+      CurrentEffect = first;
+      for(uint32_t frame = 0; frame < BENCH_WARMUP_FRAMES + transition_frames; frame++)
+      {
+        stressEffect(first);
+        hostAdvanceMicros(FRAME_PERIOD_US);
+        loop();
+      }
+
+      int outgoing_fd, incoming_fd;
+      pid_t outgoing_child = forkTransitionReference(&outgoing_fd, first, first, transition_frames);
+      pid_t incoming_child = forkTransitionReference(&incoming_fd, stream, second, transition_frames);
+      if(outgoing_child < 0 || incoming_child < 0)
+      {
+        fprintf(stderr, "transition: can't fork the reference runs\n");
+        return 1;
+      }
+
+      stressEffect(first);
+      hostAdvanceMicros(FRAME_PERIOD_US);
+      loop();
+      CurrentEffect = second;
+      uint64_t total_ns = 0, worst_ns = 0;
+      for(uint32_t frame = 0; frame < transition_frames; frame++)
+      {
+        stressEffect(first);
+        stressEffect(second);
+        hostAdvanceMicros(FRAME_PERIOD_US);
+        uint64_t start = hostNanos();
+        loop();
+        uint64_t elapsed = hostNanos() - start;
+        total_ns += elapsed;
+        worst_ns = elapsed > worst_ns ? elapsed : worst_ns;
+        memcpy(outgoing + frame * FRAME_PIXELS, frameTargetPixels(ActiveTarget ^ 1), FRAME_PIXELS * sizeof(uint32_t));
+        memcpy(incoming + frame * FRAME_PIXELS, frameTargetPixels(ActiveTarget), FRAME_PIXELS * sizeof(uint32_t));
+      }
+
+      uint32_t outgoing_mismatched = compareTransitionReference(outgoing_fd, outgoing_child, outgoing, transition_frames, fading_frames);
+      uint32_t incoming_mismatched = compareTransitionReference(incoming_fd, incoming_child, incoming, transition_frames, transition_frames);
+      ok = ok && outgoing_mismatched == 0 && incoming_mismatched == 0;
+      char name[32];
+      snprintf(name, sizeof(name), "%s > %s", Effects[first]->name, Effects[second]->name);
+      printf("%-26s %12llu %12llu %9s %9s\n", name, (unsigned long long)(total_ns / transition_frames), (unsigned long long)worst_ns,
+        outgoing_mismatched ? "FAILED" : "ok", incoming_mismatched ? "FAILED" : "ok");
+    }
+  }
+  free(outgoing);
+  free(incoming);
+#endif
+  return ok ? 0 : 1;
+}
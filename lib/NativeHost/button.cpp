@@ -0,0 +1,149 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  button.cpp (native host build)
+  Button input check. Plays edge scripts on the button pin, calling its
+  interrupt handler at each edge's time, while loop() runs frames on the
+  virtual clock. Each script says how many presses it should count after
+  debouncing: clean presses, contacts that bounce on press and release,
+  glitches shorter than BUTTON_DEBOUNCE_MS, and a burst that overflows the
+  event ring. Then times the interrupt handler itself.
+*/
+
+#include <stdio.h>
+#include "config.h"
+#include "host.h"
+#include "input.h"
+
+#define BUTTON_STEP_US 50 //Virtual time between checks for the script's next edge
+#define BUTTON_IDLE_MS 300 //Time left released after each script
+
+struct button_edge_s
+{
+  uint32_t at_us; // From the start of the script
+  uint8_t level;
+};
+
+struct button_script_s
+{
+  const char *name;
+  const struct button_edge_s *edges;
+  uint32_t edge_count;
+  uint32_t presses; // Expected
+};
+
+static const struct button_edge_s Clean_Press[] = {{0, LOW}, {150000, HIGH}};
+static const struct button_edge_s Bouncy_Press[] =
+{
+  {0, LOW}, {300, HIGH}, {800, LOW}, {1100, HIGH}, {1500, LOW}, {1700, HIGH}, {2400, LOW},
+  {150000, HIGH}, {150400, LOW}, {150900, HIGH}, {151200, LOW}, {152000, HIGH}
+};
+static const struct button_edge_s Glitch[] = {{0, LOW}, {2000, HIGH}, {40000, LOW}, {45000, HIGH}};
+static const struct button_edge_s Double_Press[] = {{0, LOW}, {80000, HIGH}, {160000, LOW}, {240000, HIGH}};
+static const struct button_edge_s Held[] = {{0, LOW}, {3000000, HIGH}};
+static struct button_edge_s Burst[4 * INPUT_QUEUE_SIZE + 2]; // Filled in by buttonCheckMain()
+
+static const struct button_script_s Button_Scripts[] =
+{
+  {"clean press", Clean_Press, sizeof(Clean_Press) / sizeof(Clean_Press[0]), 1},
+  {"bouncy press", Bouncy_Press, sizeof(Bouncy_Press) / sizeof(Bouncy_Press[0]), 1},
+  {"glitches", Glitch, sizeof(Glitch) / sizeof(Glitch[0]), 0},
+  {"double press", Double_Press, sizeof(Double_Press) / sizeof(Double_Press[0]), 2},
+  {"held 3 s", Held, sizeof(Held) / sizeof(Held[0]), 1},
+  {"ring overflow", Burst, sizeof(Burst) / sizeof(Burst[0]), 1},
+};
+
+static void buttonEdge(uint8_t level)
+{
+  digitalWrite(PIN_BUTTON, level);
+  hostTriggerInterrupt(PIN_BUTTON);
+}
+
+//Runs the script, then BUTTON_IDLE_MS released. Returns the presses loop() took in.
+static uint32_t playButtonScript(const struct button_script_s *script)
+{
+  uint32_t presses = InputStats.presses;
+  uint32_t end_us = script->edges[script->edge_count - 1].at_us + BUTTON_IDLE_MS * 1000;
+  uint32_t edge = 0;
+  for(uint32_t time_us = 0; time_us <= end_us; time_us += BUTTON_STEP_US)
+  {
+    while(edge < script->edge_count && script->edges[edge].at_us <= time_us)
+    {
+      buttonEdge(script->edges[edge++].level);
+    }
+    loop();
+    hostAdvanceMicros(BUTTON_STEP_US);
+  }
+  return InputStats.presses - presses;
+}
+
+int buttonCheckMain(int argc, char **argv)
+{
+  uint32_t edges = argc > 0 ? strtoul(argv[0], NULL, 0) : 1000000;
+  if(edges == 0)
+  {
+    fprintf(stderr, "button: edges must be greater than 0\n");
+    return 1;
+  }
+
+  //Twice as many edges as the ring holds, 10 us apart, ending on the button held down
+  const uint32_t burst_edges = sizeof(Burst) / sizeof(Burst[0]) - 1;
+  for(uint32_t edge = 0; edge < burst_edges; edge++)
+  {
+    Burst[edge].at_us = edge * 10;
+    Burst[edge].level = edge % 2 ? HIGH : LOW;
+  }
+  Burst[burst_edges].at_us = 200000;
+  Burst[burst_edges].level = HIGH;
+
+  digitalWrite(PIN_BUTTON, HIGH);
+  setup();
+  bool ok = true;
+  printf("%-16s %8s %8s\n", "script", "presses", "expected");
+  for(uint32_t script = 0; script < sizeof(Button_Scripts) / sizeof(Button_Scripts[0]); script++)
+  {
+    uint32_t effect = CurrentEffect;
+    uint32_t presses = playButtonScript(&Button_Scripts[script]);
+    bool script_ok = presses == Button_Scripts[script].presses && CurrentEffect == (effect + presses) % EffectCount;
+    ok = ok && script_ok;
+    printf("%-16s %8u %8u%s\n", Button_Scripts[script].name, presses, Button_Scripts[script].presses, script_ok ? "" : "  FAILED");
+  }
+  printf("ring overflows %u\n", InputStats.overflows);
+  ok = ok && InputStats.overflows > 0;
+
+  //The handler alone, with the ring drained before it fills
+  uint64_t start = hostNanos();
+  for(uint32_t edge = 0; edge < edges; edge++)
+  {
+    buttonEdge(edge % 2 ? HIGH : LOW);
+    if(edge % INPUT_QUEUE_SIZE == INPUT_QUEUE_SIZE - 1)
+    {
+      inputPresses(micros());
+    }
+  }
+  printf("interrupt      %6.1f ns/edge, drain included\n", (double)(hostNanos() - start) / edges);
+  printf("button %s\n", ok ? "ok" : "FAILED");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  host.h (native host build)
+  Entry points of the host command line tool and the firmware symbols it drives.
+*/
+
+#ifndef NATIVE_HOST_H
+#define NATIVE_HOST_H
+
+#include <Arduino.h>
+#include "effect.h"
+
+// Firmware entry points and state, defined in src/
+void setup();
+void loop();
+extern uint32_t CurrentEffect;
+extern uint32_t ActiveTarget;
+
+// Host commands. Each receives the arguments following its name.
+int benchMain(int argc, char **argv);
+int benchEncodeMain(int argc, char **argv);
+int benchDitherMain(int argc, char **argv);
+int benchBlendMain(int argc, char **argv);
+int benchFixedMain(int argc, char **argv);
+int benchRngMain(int argc, char **argv);
+int benchTransitionMain(int argc, char **argv);
+int buttonCheckMain(int argc, char **argv);
+int timingMain(int argc, char **argv);
+int treeCheckMain(int argc, char **argv);
+int runMain(int argc, char **argv);
+int renderMain(int argc, char **argv);
+int goldenMain(int argc, char **argv);
+int recordMain(int argc, char **argv);
+int playbackCheckMain(int argc, char **argv);
+int streamMain(int argc, char **argv);
+int streamCheckMain(int argc, char **argv);
+int telemetryMain(int argc, char **argv);
+
+// Wall clock in nanoseconds, used to time work done by the firmware
+uint64_t hostNanos();
+
+#endif
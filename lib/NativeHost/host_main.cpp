@@ -0,0 +1,132 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  host_main.cpp (native host build)
+  Command line front end of the native build. The firmware's setup() and
+  loop() are driven from here against the virtual clock in Arduino.cpp.
+*/
+
+#include <stdio.h>
+#include <time.h>
+#include "config.h"
+#include "host.h"
+
+struct host_command_s
+{
+  const char *name;
+  int (* run)(int argc, char **argv);
+  const char *usage;
+  const char *help;
+};
+
+const struct host_command_s Host_Commands[] =
+{
+  {"run", runMain, "run [frames]", "Run setup() and loop() against the virtual clock"},
+  {"bench", benchMain, "bench [frames] [worst|typical]", "Measure the per-frame cost of every effect"},
+  {"encode", benchEncodeMain, "encode [frames]", "Time frameEncode() and check it against OctoWS2811::setPixel()"},
+  {"dither", benchDitherMain, "dither [frames]", "Time the dithering kernel for 8x150 and 8x600 LEDs and check its average"},
+  {"blend", benchBlendMain, "blend [frames]", "Check every blend mode and time the add and max spans"},
+  {"telemetry", telemetryMain, "telemetry [frames]", "Run each effect, then print the telemetry dump"},
+  {"render", renderMain, "render <effect> <frames> <ppm> [seed]", "Write an effect's frames from a fixed seed as a PPM strip image"},
+  {"golden", goldenMain, "golden <effect> <ppm> [tolerance] [seed]", "Render an effect again, from the image's seed, and compare it with a PPM strip image"},
+  {"record", recordMain, "record <effect|rgb file> <frames> <name>", "Print an effect or raw RGB frames as an animation for src/animations"},
+  {"playback-check", playbackCheckMain, "playback-check [frames]", "Record every effect, then decode and check the recording"},
+  {"stream", streamMain, "stream [seconds]", "Show Adalight frames sent to a pseudo-terminal, in real time"},
+  {"stream-check", streamCheckMain, "stream-check [frames]", "Send good and broken Adalight frames through a pseudo-terminal and check them"},
+  {"fixed", benchFixedMain, "fixed [rounds]", "Compare the float and Q16.16 spotlight falloff math"},
+  {"rng", benchRngMain, "rng [bursts]", "Time particle spawn bursts with random() and with rng.h, and check the streams"},
+  {"transition", benchTransitionMain, "transition [frames]", "Check and time the transition styles, then time loop() through every transition"},
+  {"button-check", buttonCheckMain, "button-check [edges]", "Play bouncing button edge scripts through the input ring and check the presses counted"},
+  {"timing", timingMain, "timing [fps] [draw us] [encode us]", "Print the frame rate the wire and each effect allow, for this build and common strand sizes"},
+  {"tree", treeCheckMain, "tree [frames]", "Check the tree coordinate table and its band and sector lookups, and time a rotating beam with and without it"},
+};
+
+uint64_t hostNanos()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+int runMain(int argc, char **argv)
+{
+  uint32_t frames = argc > 0 ? strtoul(argv[0], NULL, 0) : 1000;
+
+  setup();
+  for(uint32_t frame = 0; frame < frames; frame++)
+  {
+    hostAdvanceMicros(1000000 / TARGET_FPS);
+    loop();
+  }
+  printf("Ran %u frames, virtual time %u ms\n", frames, millis());
+  return 0;
+}
+
+/*
+  Runs every effect for a while, then asks for a telemetry dump over
+  the (stand-in) USB serial port and keeps calling loop() until it is out.
+*/
+int telemetryMain(int argc, char **argv)
+{
+  uint32_t frames = argc > 0 ? strtoul(argv[0], NULL, 0) : 600;
+
+  setup();
+  for(uint32_t effect = 0; effect < EffectCount; effect++)
+  {
+    CurrentEffect = effect;
+    for(uint32_t frame = 0; frame < frames; frame++)
+    {
+      hostAdvanceMicros(1000000 / TARGET_FPS);
+      loop();
+    }
+  }
+
+  const uint8_t command = 't';
+  hostSerialInject(&command, 1);
+  for(int call = 0; call < 1000; call++)
+  {
+    loop();
+  }
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  const char *command = argc > 1 ? argv[1] : "run";
+  for(uint32_t i = 0; i < sizeof(Host_Commands) / sizeof(Host_Commands[0]); i++)
+  {
+    if(strcmp(command, Host_Commands[i].name) == 0)
+    {
+      return Host_Commands[i].run(argc > 1 ? argc - 2 : 0, argv + 2);
+    }
+  }
+
+  fprintf(stderr, "usage: %s <command> [args]\n", argv[0]);
+  for(uint32_t i = 0; i < sizeof(Host_Commands) / sizeof(Host_Commands[0]); i++)
+  {
+    fprintf(stderr, "  %-32s %s\n", Host_Commands[i].usage, Host_Commands[i].help);
+  }
+  return 1;
+}
@@ -0,0 +1,336 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  record.cpp (native host build)
+  Records animations for the Playback effect. "record" renders an effect, or
+  reads raw RGB frames from a file, and prints them as an animation.h stream
+  in a C++ file for src/animations. "playback-check" records every effect,
+  decodes the recording again, and checks it matches frame for frame.
+*/
+
+#include <ctype.h>
+#include "animation.h"
+#include "config.h"
+#include "frame.h"
+#include "host.h"
+#include "rng.h"
+
+#define RECORD_FRAME_PERIOD_US (1000000 / TARGET_FPS)
+#define RECORD_MAX_FRAME_BYTES (FRAME_PIXELS * 4 + 1) // No pixel costs more than a one pixel literal, plus the end op
+
+//Recordings are part of the source tree, so they carry its license like any other file
+static const char License[] =
+  "/*\n"
+  "MIT License\n"
+  "\n"
+  "Copyright (c) 2020 Chase Baker\n"
+  "\n"
+  "Permission is hereby granted, free of charge, to any person obtaining a copy\n"
+  "of this software and associated documentation files (the \"Software\"), to deal\n"
+  "in the Software without restriction, including without limitation the rights\n"
+  "to use, copy, modify, merge, publish, distribute, sublicense, and/or sell\n"
+  "copies of the Software, and to permit persons to whom the Software is\n"
+  "furnished to do so, subject to the following conditions:\n"
+  "\n"
+  "The above copyright notice and this permission notice shall be included in all\n"
+  "copies or substantial portions of the Software.\n"
+  "\n"
+  "THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR\n"
+  "IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,\n"
+  "FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE\n"
+  "AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER\n"
+  "LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,\n"
+  "OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE\n"
+  "SOFTWARE.\n"
+  "*/";
+
+struct recording_s
+{
+  uint8_t *data;
+  uint32_t length;
+  uint32_t capacity;
+  uint32_t frames; // Frame periods, holds included
+  uint32_t worst_frame; // Bytes of the largest frame
+  uint32_t last[FRAME_PIXELS]; // The frame last recorded, which the next is coded against
+  uint32_t end; // Offset of the last frame's end op
+};
+
+/*
+  Codes frame against last, without the end op. Unchanged pixels become
+  skips, runs of one color fills, and anything else literals. Literals stop
+  at the first unchanged pixel or repeated color, which are cheaper coded
+  on their own. Unchanged pixels at the end aren't coded at all.
+*/
+static uint32_t encodeFrame(const uint32_t *frame, const uint32_t *last, uint8_t *out)
+{
+  uint32_t end = FRAME_PIXELS;
+  while(end > 0 && frame[end - 1] == last[end - 1])
+  {
+    end--;
+  }
+
+  uint32_t length = 0;
+  uint32_t led = 0;
+  while(led < end)
+  {
+    uint32_t run = 1;
+    if(frame[led] == last[led])
+    {
+      while(led + run < end && run < ANIMATION_RUN_MAX && frame[led + run] == last[led + run])
+      {
+        run++;
+      }
+      out[length++] = ANIMATION_SKIP | (run - 1);
+    }
+    else
+    {
+      while(led + run < end && run < ANIMATION_RUN_MAX && frame[led + run] == frame[led])
+      {
+        run++;
+      }
+      if(run > 1)
+      {
+        out[length++] = ANIMATION_FILL | (run - 1);
+        out[length++] = frame[led] >> 16;
+        out[length++] = frame[led] >> 8;
+        out[length++] = frame[led];
+      }
+      else
+      {
+        while(led + run < end && run < ANIMATION_RUN_MAX && frame[led + run] != last[led + run] &&
+          !(led + run + 1 < end && frame[led + run] == frame[led + run + 1]))
+        {
+          run++;
+        }
+        out[length++] = ANIMATION_LITERAL | (run - 1);
+        for(uint32_t pixel = led; pixel < led + run; pixel++)
+        {
+          out[length++] = frame[pixel] >> 16;
+          out[length++] = frame[pixel] >> 8;
+          out[length++] = frame[pixel];
+        }
+      }
+    }
+    led += run;
+  }
+  return length;
+}
+
+static void recordFrame(struct recording_s *recording, const uint32_t *frame)
+{
+  recording->frames++;
+  //A repeat of the last frame only lengthens its hold
+  if(recording->length > 0 && memcmp(frame, recording->last, sizeof(recording->last)) == 0 &&
+    (recording->data[recording->end] & ~ANIMATION_OP_MASK) + 1 < ANIMATION_RUN_MAX)
+  {
+    recording->data[recording->end]++;
+    return;
+  }
+
+  if(recording->length + RECORD_MAX_FRAME_BYTES > recording->capacity)
+  {
+    recording->capacity = recording->capacity * 2 + RECORD_MAX_FRAME_BYTES;
+    recording->data = (uint8_t *)realloc(recording->data, recording->capacity);
+  }
+  uint32_t length = encodeFrame(frame, recording->last, recording->data + recording->length);
+  recording->end = recording->length + length;
+  recording->data[recording->end] = ANIMATION_END;
+  if(length + 1 > recording->worst_frame)
+  {
+    recording->worst_frame = length + 1;
+  }
+  recording->length += length + 1;
+  memcpy(recording->last, frame, sizeof(recording->last));
+}
+
+//The last frame starts out black, like the strand before the first frame.
+static struct recording_s * newRecording()
+{
+  return (struct recording_s *)calloc(1, sizeof(struct recording_s));
+}
+
+static int findEffect(const char *name)
+{
+  for(uint32_t effect = 0; effect < EffectCount; effect++)
+  {
+    if(strcmp(Effects[effect]->name, name) == 0)
+    {
+      return effect;
+    }
+  }
+  return -1;
+}
+
+//Runs effect for frames frame periods and records each one. If kept is given, the frames are copied there as well.
+static void recordEffect(uint32_t effect, uint32_t frames, struct recording_s *recording, uint32_t *kept)
+{
+  CurrentEffect = effect;
+  for(uint32_t frame = 0; frame < frames; frame++)
+  {
+    hostAdvanceMicros(RECORD_FRAME_PERIOD_US);
+    loop();
+    recordFrame(recording, Frame);
+    if(kept)
+    {
+      memcpy(kept + frame * FRAME_PIXELS, Frame, FRAME_PIXELS * sizeof(Frame[0]));
+    }
+  }
+}
+
+//Prints recording as a C++ file defining the animation_s for name.
+static void printRecording(const struct recording_s *recording, const char *name, int argc, char **argv)
+{
+  char identifier[64];
+  uint32_t length = 0;
+  for(const char *c = name; *c && length < sizeof(identifier) - 1; c++)
+  {
+    identifier[length] = length == 0 || identifier[length - 1] == '_' ? toupper(*c) : *c;
+    length++;
+  }
+  identifier[length] = 0;
+
+  printf("%s\n\n", License);
+  printf("/*\n  %s.cpp\n  Recorded with `program record", name);
+  for(int arg = 0; arg < argc; arg++)
+  {
+    printf(" %s", argv[arg]);
+  }
+  printf("`.\n  %u frames of %u LEDs at %u fps, %u bytes (%u raw). Regenerate it rather than editing it.\n*/\n\n",
+    recording->frames, FRAME_PIXELS, TARGET_FPS, recording->length, recording->frames * FRAME_PIXELS * 3);
+  printf("#include \"animation.h\"\n\nstatic const uint8_t Data[] =\n{");
+  for(uint32_t byte = 0; byte < recording->length; byte++)
+  {
+    printf("%s0x%02X%s", byte % 12 == 0 ? "\n  " : " ", recording->data[byte], byte + 1 < recording->length ? "," : "");
+  }
+  printf("\n};\n\nextern const struct animation_s %s =\n{\n  \"%s\",\n  %u,\n  %u,\n  sizeof(Data),\n  Data\n};\n",
+    identifier, name, FRAME_PIXELS, RECORD_FRAME_PERIOD_US);
+}
+
+int recordMain(int argc, char **argv)
+{
+  if(argc < 3)
+  {
+    fprintf(stderr, "record: needs an effect name or raw RGB file, a frame count, and an animation name\n");
+    return 1;
+  }
+  uint32_t frames = strtoul(argv[1], NULL, 0);
+  struct recording_s *recording = newRecording();
+
+  int effect = findEffect(argv[0]);
+  if(effect >= 0)
+  {
+    setup();
+    rngBegin(1);
+    recordEffect(effect, frames, recording, NULL);
+  }
+  else
+  {
+    //Raw frames are FRAME_PIXELS R G B triples each, as a video tool would write them with -pix_fmt rgb24
+    FILE *file = fopen(argv[0], "rb");
+    if(!file)
+    {
+      fprintf(stderr, "record: %s is neither an effect nor a readable file\n", argv[0]);
+      return 1;
+    }
+    static uint8_t rgb[FRAME_PIXELS * 3];
+    static uint32_t frame[FRAME_PIXELS];
+    for(uint32_t count = 0; count < frames && fread(rgb, sizeof(rgb), 1, file) == 1; count++)
+    {
+      for(uint32_t led = 0; led < FRAME_PIXELS; led++)
+      {
+        frame[led] = (uint32_t)rgb[led * 3] << 16 | (uint32_t)rgb[led * 3 + 1] << 8 | rgb[led * 3 + 2];
+      }
+      recordFrame(recording, frame);
+    }
+    fclose(file);
+  }
+
+  printRecording(recording, argv[2], argc, argv);
+  fprintf(stderr, "%u frames, %u bytes, largest frame %u bytes\n", recording->frames, recording->length, recording->worst_frame);
+  return 0;
+}
+
+/*
+  Records each built-in effect, then plays the recording back through
+  animationDecodeFrame() the way the Playback effect does, checking every
+  frame against the one recorded and timing the decode. A decode never
+  costs more than writing the whole strand, which the worst frame shows.
+*/
+int playbackCheckMain(int argc, char **argv)
+{
+  uint32_t frames = argc > 0 ? strtoul(argv[0], NULL, 0) : 600;
+  uint32_t *kept = (uint32_t *)malloc((size_t)frames * FRAME_PIXELS * sizeof(uint32_t));
+  bool ok = true;
+
+  setup();
+  rngBegin(1);
+  printf("%-12s %10s %12s %12s %14s %14s\n", "effect", "bytes", "bytes/frame", "worst frame", "decode ns/frm", "worst ns");
+  for(uint32_t effect = 0; effect < EffectCount; effect++)
+  {
+    if(Effects[effect] == &Playback || Effects[effect]->service)
+    {
+      continue; //Nothing to record that didn't come from somewhere else
+    }
+    struct recording_s *recording = newRecording();
+    recordEffect(effect, frames, recording, kept);
+
+    memset(Frame, 0, FRAME_PIXELS * sizeof(Frame[0]));
+    const uint8_t *data = recording->data;
+    uint64_t total_ns = 0;
+    uint64_t worst_ns = 0;
+    uint32_t decoded = 0;
+    for(uint32_t frame = 0; frame < frames && ok; decoded++)
+    {
+      uint32_t hold;
+      uint64_t start = hostNanos();
+      data = animationDecodeFrame(data, FRAME_PIXELS, &hold);
+      uint64_t elapsed = hostNanos() - start;
+      total_ns += elapsed;
+      worst_ns = elapsed > worst_ns ? elapsed : worst_ns;
+      for(uint32_t held = 0; held < hold && ok; held++, frame++)
+      {
+        if(memcmp(Frame, kept + frame * FRAME_PIXELS, FRAME_PIXELS * sizeof(Frame[0])) != 0)
+        {
+          printf("FAIL %s: frame %u doesn't match\n", Effects[effect]->name, frame);
+          ok = false;
+        }
+      }
+    }
+    if(ok && data != recording->data + recording->length)
+    {
+      printf("FAIL %s: %u bytes left after the last frame\n", Effects[effect]->name,
+        (uint32_t)(recording->data + recording->length - data));
+      ok = false;
+    }
+    printf("%-12s %10u %12.1f %12u %14llu %14llu\n", Effects[effect]->name, recording->length,
+      (double)recording->length / frames, recording->worst_frame,
+      (unsigned long long)(total_ns / (decoded ? decoded : 1)), (unsigned long long)worst_ns);
+    free(recording->data);
+    free(recording);
+  }
+  free(kept);
+  printf("raw frame: %u bytes\n%s\n", FRAME_PIXELS * 3, ok ? "playback ok" : "playback FAILED");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,257 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  render.cpp (native host build)
+  Offline renderer. Runs one effect from a fixed seed on the virtual clock,
+  one frame period per frame, and keeps what it drew in Frame each frame.
+  "render" writes the frames as a PPM strip image, one row per frame and one
+  column per LED, in the perceptual colors effects draw (before gamma,
+  brightness, and dithering). The seed and time per frame go in a comment.
+  "golden" renders again from that seed and compares against the image, so
+  a change to an effect can be shown to leave its output bit-identical, or
+  within a tolerance, along with how much faster it got.
+*/
+
+#include <ctype.h>
+#include "config.h"
+#include "frame.h"
+#include "host.h"
+#include "rng.h"
+
+struct golden_notes_s
+{
+  uint32_t seed;
+  unsigned long long ns_per_frame; // 0 if the image doesn't say
+};
+
+struct render_s
+{
+  uint8_t *rgb; // frames rows of FRAME_PIXELS R G B triples
+  uint32_t frames;
+  uint64_t total_ns; // Time spent in loop()
+  uint64_t worst_ns;
+};
+
+static int findRenderEffect(const char *name)
+{
+  for(uint32_t effect = 0; effect < EffectCount; effect++)
+  {
+    if(strcmp(Effects[effect]->name, name) == 0)
+    {
+      return effect;
+    }
+  }
+  fprintf(stderr, "unknown effect %s; effects are:", name);
+  for(uint32_t effect = 0; effect < EffectCount; effect++)
+  {
+    fprintf(stderr, " %s", Effects[effect]->name);
+  }
+  fprintf(stderr, "\n");
+  return -1;
+}
+
+static void renderEffect(uint32_t effect, uint32_t frames, uint32_t seed, struct render_s *render)
+{
+  memset(render, 0, sizeof(*render));
+  render->rgb = (uint8_t *)malloc((size_t)frames * FRAME_PIXELS * 3);
+  render->frames = frames;
+
+  setup();
+  hostSetMicros(0);
+  rngBegin(seed); //setup() seeded from the floating pin; the effect seeds its stream on the first loop()
+  CurrentEffect = effect;
+  for(uint32_t frame = 0; frame < frames; frame++)
+  {
+    hostAdvanceMicros(1000000 / TARGET_FPS);
+    uint64_t start = hostNanos();
+    loop();
+    uint64_t elapsed = hostNanos() - start;
+    render->total_ns += elapsed;
+    render->worst_ns = elapsed > render->worst_ns ? elapsed : render->worst_ns;
+
+    uint8_t *row = render->rgb + (size_t)frame * FRAME_PIXELS * 3;
+    for(uint32_t led = 0; led < FRAME_PIXELS; led++)
+    {
+      row[led * 3] = Frame[led] >> 16;
+      row[led * 3 + 1] = Frame[led] >> 8;
+      row[led * 3 + 2] = Frame[led];
+    }
+  }
+}
+
+static void printRenderTime(const char *name, const struct render_s *render)
+{
+  printf("%s: %u frames, %llu ns/frame, worst %llu ns\n", name, render->frames,
+    (unsigned long long)(render->total_ns / render->frames), (unsigned long long)render->worst_ns);
+}
+
+/*
+  Reads a number from a PPM header, skipping whitespace and # comments. The
+  comment render writes fills in notes.
+*/
+static bool readPpmNumber(FILE *file, uint32_t *value, struct golden_notes_s *notes)
+{
+  int c = fgetc(file);
+  while(c == '#' || isspace(c))
+  {
+    if(c == '#')
+    {
+      char comment[128];
+      if(!fgets(comment, sizeof(comment), file))
+      {
+        return false;
+      }
+      sscanf(comment, " %*[^,], seed %u, %*u fps, %llu ns/frame", &notes->seed, &notes->ns_per_frame);
+    }
+    c = fgetc(file);
+  }
+  if(!isdigit(c))
+  {
+    return false;
+  }
+  *value = 0;
+  while(isdigit(c))
+  {
+    *value = *value * 10 + (c - '0');
+    c = fgetc(file);
+  }
+  return true; //The single whitespace after the number went with it, as the format wants
+}
+
+int renderMain(int argc, char **argv)
+{
+  if(argc < 3)
+  {
+    fprintf(stderr, "render: needs an effect, a frame count, and an output file\n");
+    return 1;
+  }
+  int effect = findRenderEffect(argv[0]);
+  uint32_t frames = strtoul(argv[1], NULL, 0);
+  uint32_t seed = argc > 3 ? strtoul(argv[3], NULL, 0) : 1;
+  if(effect < 0 || frames == 0)
+  {
+    return 1;
+  }
+
+  struct render_s render;
+  renderEffect(effect, frames, seed, &render);
+  FILE *file = fopen(argv[2], "wb");
+  if(!file)
+  {
+    fprintf(stderr, "render: can't write %s\n", argv[2]);
+    return 1;
+  }
+  fprintf(file, "P6\n# %s, seed %u, %u fps, %llu ns/frame\n%u %u\n255\n", argv[0], seed, TARGET_FPS,
+    (unsigned long long)(render.total_ns / frames), FRAME_PIXELS, frames);
+  fwrite(render.rgb, 3, (size_t)frames * FRAME_PIXELS, file);
+  fclose(file);
+  printRenderTime(argv[0], &render);
+  free(render.rgb);
+  return 0;
+}
+
+int goldenMain(int argc, char **argv)
+{
+  if(argc < 2)
+  {
+    fprintf(stderr, "golden: needs an effect and a golden image\n");
+    return 1;
+  }
+  int effect = findRenderEffect(argv[0]);
+  uint32_t tolerance = argc > 2 ? strtoul(argv[2], NULL, 0) : 0;
+  struct golden_notes_s notes = {1, 0};
+  if(effect < 0)
+  {
+    return 1;
+  }
+
+  FILE *file = fopen(argv[1], "rb");
+  uint32_t width, height, max;
+  if(!file || fgetc(file) != 'P' || fgetc(file) != '6' ||
+    !readPpmNumber(file, &width, &notes) || !readPpmNumber(file, &height, &notes) || !readPpmNumber(file, &max, &notes) || max != 255)
+  {
+    fprintf(stderr, "golden: %s isn't an 8 bit PPM image\n", argv[1]);
+    return 1;
+  }
+  if(width != FRAME_PIXELS || height == 0)
+  {
+    fprintf(stderr, "golden: %s is %u LEDs wide, the strand has %u\n", argv[1], width, FRAME_PIXELS);
+    return 1;
+  }
+  size_t length = (size_t)width * height * 3;
+  uint8_t *golden = (uint8_t *)malloc(length);
+  if(fread(golden, 1, length, file) != length)
+  {
+    fprintf(stderr, "golden: %s is cut short\n", argv[1]);
+    return 1;
+  }
+  fclose(file);
+  if(argc > 3)
+  {
+    notes.seed = strtoul(argv[3], NULL, 0);
+  }
+
+  struct render_s render;
+  renderEffect(effect, height, notes.seed, &render);
+
+  uint32_t worst = 0;
+  uint64_t differing = 0;
+  int64_t first_frame = -1;
+  for(size_t byte = 0; byte < length; byte++)
+  {
+    uint32_t difference = abs((int)render.rgb[byte] - (int)golden[byte]);
+    if(difference == 0)
+    {
+      continue;
+    }
+    differing++;
+    worst = difference > worst ? difference : worst;
+    if(first_frame < 0)
+    {
+      first_frame = byte / (FRAME_PIXELS * 3);
+    }
+  }
+
+  printRenderTime(argv[0], &render);
+  if(notes.ns_per_frame > 0)
+  {
+    printf("%.2fx the speed of the golden render (%llu ns/frame)\n",
+      (double)notes.ns_per_frame * render.frames / render.total_ns, notes.ns_per_frame);
+  }
+  if(differing == 0)
+  {
+    printf("bit-identical to %s\n", argv[1]);
+  }
+  else
+  {
+    printf("%llu channels differ from %s, by up to %u, first in frame %lld\n", (unsigned long long)differing, argv[1], worst,
+      (long long)first_frame);
+  }
+  free(golden);
+  free(render.rgb);
+  bool ok = worst <= tolerance;
+  printf("%s\n", ok ? "golden ok" : "golden FAILED");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,270 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  stream.cpp (native host build)
+  Drives the Serial Stream effect through a pseudo-terminal. "stream" moves
+  the serial port onto one and runs the firmware in real time, so a show
+  controller can be pointed at it; "stream-check" opens the other end itself
+  and sends good and broken Adalight frames, checking what lands in Frame
+  and what the counters make of it.
+*/
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include "config.h"
+#include "frame.h"
+#include "host.h"
+#include "telemetry.h"
+
+#define STREAM_CHECK_MAX_LEDS (FRAME_PIXELS + 16)
+
+static int findStreamEffect()
+{
+  for(uint32_t effect = 0; effect < EffectCount; effect++)
+  {
+    if(Effects[effect] == &SerialStream)
+    {
+      return effect;
+    }
+  }
+  return -1;
+}
+
+static void printStreamStats()
+{
+  printf("frames %u, dropped %u", TelemetryStream.frames, TelemetryStream.dropped);
+  if(TelemetryStream.frames > 0)
+  {
+    printf(", latency min %u avg %llu max %u us", TelemetryStream.min_latency_us,
+      (unsigned long long)(TelemetryStream.total_latency_us / TelemetryStream.frames), TelemetryStream.max_latency_us);
+  }
+  printf("\n");
+}
+
+int streamMain(int argc, char **argv)
+{
+  uint32_t seconds = argc > 0 ? strtoul(argv[0], NULL, 0) : 60;
+  const char *path = hostSerialOpenPty();
+  if(!path)
+  {
+    fprintf(stderr, "stream: couldn't open a pseudo-terminal\n");
+    return 1;
+  }
+  printf("Send Adalight frames to %s for %u s\n", path, seconds);
+  fflush(stdout);
+
+  setup();
+  CurrentEffect = findStreamEffect();
+  uint64_t start = hostNanos();
+  uint64_t elapsed_us = 0;
+  while(elapsed_us < (uint64_t)seconds * 1000000)
+  {
+    hostSetMicros(elapsed_us);
+    loop();
+    usleep(200);
+    elapsed_us = (hostNanos() - start) / 1000;
+  }
+  printStreamStats();
+  return 0;
+}
+
+/*
+  Writes all of data to the other end of the pseudo-terminal, running the
+  firmware for a millisecond of virtual time whenever it is full.
+*/
+static void feedStream(int peer, const uint8_t *data, size_t length)
+{
+  while(length > 0)
+  {
+    ssize_t written = write(peer, data, length);
+    if(written > 0)
+    {
+      data += written;
+      length -= written;
+      continue;
+    }
+    hostAdvanceMicros(1000);
+    loop();
+  }
+}
+
+static void sendStreamFrame(int peer, const uint32_t *colors, uint32_t leds, bool good_checksum)
+{
+  static uint8_t message[6 + STREAM_CHECK_MAX_LEDS * 3];
+  uint8_t count_hi = (leds - 1) >> 8;
+  uint8_t count_lo = (leds - 1) & 0xFF;
+  uint8_t header[6] = {'A', 'd', 'a', count_hi, count_lo, (uint8_t)(count_hi ^ count_lo ^ (good_checksum ? 0x55 : 0xAA))};
+  memcpy(message, header, sizeof(header));
+  for(uint32_t led = 0; led < leds; led++)
+  {
+    message[6 + led * 3] = colors[led] >> 16;
+    message[6 + led * 3 + 1] = colors[led] >> 8;
+    message[6 + led * 3 + 2] = colors[led];
+  }
+  feedStream(peer, message, 6 + leds * 3);
+}
+
+//Runs the firmware until a streamed frame has been encoded, or a second has gone by
+static bool waitForStreamFrame()
+{
+  uint32_t frames = TelemetryStream.frames;
+  for(int ms = 0; ms < 1000; ms++)
+  {
+    hostAdvanceMicros(1000);
+    loop();
+    if(TelemetryStream.frames != frames)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool checkStreamFrame(const char *what, const uint32_t *colors, uint32_t leds)
+{
+  if(!waitForStreamFrame())
+  {
+    printf("FAIL %s: no frame was shown\n", what);
+    return false;
+  }
+  for(uint32_t led = 0; led <= FRAME_PIXELS; led++)
+  {
+    uint32_t expected = led < leds && led < FRAME_PIXELS ? colors[led] & 0xFFFFFF : 0;
+    if(Frame[led] != expected)
+    {
+      printf("FAIL %s: LED %u is %06X, not %06X\n", what, led, Frame[led], expected);
+      return false;
+    }
+  }
+  return true;
+}
+
+int streamCheckMain(int argc, char **argv)
+{
+  uint32_t frames = argc > 0 ? strtoul(argv[0], NULL, 0) : 100;
+  const char *path = hostSerialOpenPty();
+  int peer = path ? open(path, O_RDWR | O_NOCTTY | O_NONBLOCK) : -1;
+  if(peer < 0)
+  {
+    fprintf(stderr, "stream-check: couldn't open a pseudo-terminal\n");
+    return 1;
+  }
+
+  randomSeed(1);
+  setup();
+  CurrentEffect = findStreamEffect();
+  hostAdvanceMicros(1000);
+  loop();
+  telemetryReset();
+
+  static uint32_t colors[STREAM_CHECK_MAX_LEDS];
+  bool ok = true;
+  uint64_t start = hostNanos();
+  for(uint32_t frame = 0; frame < frames && ok; frame++)
+  {
+    for(uint32_t led = 0; led < STREAM_CHECK_MAX_LEDS; led++)
+    {
+      colors[led] = random(0x1000000);
+    }
+    sendStreamFrame(peer, colors, FRAME_PIXELS, true);
+    ok = checkStreamFrame("whole frame", colors, FRAME_PIXELS);
+  }
+  uint64_t elapsed = hostNanos() - start;
+  if(ok)
+  {
+    printf("%u whole frames: %.1f us of host time each\n", frames, elapsed / 1000.0 / frames);
+  }
+
+  uint32_t dropped = TelemetryStream.dropped;
+  sendStreamFrame(peer, colors, FRAME_PIXELS, false); //Skipped up to the next header, not shown
+  colors[0] ^= 0xFFFFFF;
+  sendStreamFrame(peer, colors, FRAME_PIXELS, true);
+  ok = ok && checkStreamFrame("frame after a bad checksum", colors, FRAME_PIXELS);
+  if(ok && TelemetryStream.dropped != dropped + 1)
+  {
+    printf("FAIL bad checksum: dropped went from %u to %u\n", dropped, TelemetryStream.dropped);
+    ok = false;
+  }
+
+  sendStreamFrame(peer, colors, FRAME_PIXELS / 2, true);
+  ok = ok && checkStreamFrame("short frame", colors, FRAME_PIXELS / 2);
+  sendStreamFrame(peer, colors, STREAM_CHECK_MAX_LEDS, true);
+  ok = ok && checkStreamFrame("long frame", colors, STREAM_CHECK_MAX_LEDS);
+  colors[1] ^= 0xFFFFFF;
+  sendStreamFrame(peer, colors, FRAME_PIXELS, true);
+  ok = ok && checkStreamFrame("frame after a long one", colors, FRAME_PIXELS);
+
+  //Half a frame, then nothing for longer than the stream waits
+  dropped = TelemetryStream.dropped;
+  uint8_t header[6] = {'A', 'd', 'a', (uint8_t)((FRAME_PIXELS - 1) >> 8), (uint8_t)((FRAME_PIXELS - 1) & 0xFF), 0};
+  header[5] = header[3] ^ header[4] ^ 0x55;
+  feedStream(peer, header, sizeof(header));
+  feedStream(peer, (const uint8_t *)colors, FRAME_PIXELS);
+  if(ok && waitForStreamFrame())
+  {
+    printf("FAIL stalled frame: it was shown\n");
+    ok = false;
+  }
+  if(ok && TelemetryStream.dropped != dropped + 1)
+  {
+    printf("FAIL stalled frame: dropped went from %u to %u\n", dropped, TelemetryStream.dropped);
+    ok = false;
+  }
+  sendStreamFrame(peer, colors, FRAME_PIXELS, true);
+  ok = ok && checkStreamFrame("frame after a stalled one", colors, FRAME_PIXELS);
+
+  //Between frames the dump can still be asked for, and it comes back over the terminal
+  const uint8_t command = 't';
+  feedStream(peer, &command, 1);
+  char dump[8192];
+  size_t dump_length = 0;
+  for(int call = 0; call < 2000 && dump_length < sizeof(dump) - 1; call++)
+  {
+    loop();
+    ssize_t length = read(peer, dump + dump_length, sizeof(dump) - 1 - dump_length);
+    if(length > 0)
+    {
+      dump_length += length;
+    }
+  }
+  dump[dump_length] = 0;
+  char *stream_line = strstr(dump, "\nA ");
+  if(ok && !stream_line)
+  {
+    printf("FAIL telemetry: no stream line in the dump\n");
+    ok = false;
+  }
+  if(stream_line)
+  {
+    *strchr(stream_line + 1, '\r') = 0;
+    printf("telemetry: %s\n", stream_line + 1);
+  }
+
+  printStreamStats();
+  printf("%s\n", ok ? "stream ok" : "stream FAILED");
+  close(peer);
+  return ok ? 0 : 1;
+}
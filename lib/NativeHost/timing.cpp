@@ -0,0 +1,149 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  timing.cpp (native host build)
+  Frame rate calculator built on wire_timing.h. "timing" first prints the
+  wire-limited frame rate of common strand lengths and segment counts for
+  each strand type, marking those that can't reach the target. Then it
+  runs every effect of this build under its stress() load and combines the
+  wire time with the measured stage times from telemetry: drawing
+  (update, clear, render) overlaps the previous transfer, but encoding
+  can't start until busy() ends, so a frame takes at least the longer of
+  wire + encode and draw + encode.
+
+  Host times are far shorter than the board's. To size a strand for the
+  board, pass the per-frame draw and encode times from its telemetry dump.
+*/
+
+#include <stdio.h>
+#include "config.h"
+#include "host.h"
+#include "strand.h"
+#include "telemetry.h"
+#include "wire_timing.h"
+
+#define TIMING_FRAMES 2000
+
+struct timing_strand_type_s
+{
+  const char *name;
+  uint32_t config;
+};
+
+static const struct timing_strand_type_s Timing_Strand_Types[] =
+{
+  {"WS2811 800k", WS2811_800kHz},
+  {"WS2811 400k", WS2811_400kHz},
+  {"WS2813 800k", WS2813_800kHz},
+};
+#define TIMING_STRAND_TYPES (sizeof(Timing_Strand_Types) / sizeof(Timing_Strand_Types[0]))
+
+static const uint32_t Timing_Lengths[] = {150, 300, 600, 1200, 2400};
+static const uint32_t Timing_Segments[] = {1, 2, 4, 8};
+
+//Shortest frame period given the wire and the CPU time spent drawing and encoding
+static uint32_t timingFrameUs(uint32_t leds_per_channel, uint32_t config, uint32_t draw_us, uint32_t encode_us)
+{
+  uint32_t wire_us = wireFrameUs(leds_per_channel, config) + encode_us;
+  uint32_t cpu_us = draw_us + encode_us;
+  return wire_us > cpu_us ? wire_us : cpu_us;
+}
+
+static uint32_t averageStageUs(const struct telemetry_stage_stats_s *stage)
+{
+  return stage->count ? telemetryTicksToNanos((uint32_t)(stage->total / stage->count)) / 1000 : 0;
+}
+
+static void printStrandTable(uint32_t fps, uint32_t draw_us, uint32_t encode_us)
+{
+  printf("max fps with %u us draw and %u us encode per frame, * below %u fps\n", draw_us, encode_us, fps);
+  printf("%6s %8s %8s", "leds", "segments", "per out");
+  for(uint32_t type = 0; type < TIMING_STRAND_TYPES; type++)
+  {
+    printf(" %12s", Timing_Strand_Types[type].name);
+  }
+  printf("\n");
+  for(uint32_t length : Timing_Lengths)
+  {
+    for(uint32_t segments : Timing_Segments)
+    {
+      uint32_t per_channel = (length + segments - 1) / segments;
+      printf("%6u %8u %8u", length, segments, per_channel);
+      for(uint32_t type = 0; type < TIMING_STRAND_TYPES; type++)
+      {
+        uint32_t max_fps = 1000000 / timingFrameUs(per_channel, Timing_Strand_Types[type].config, draw_us, encode_us);
+        printf(" %11u%c", max_fps, max_fps < fps ? '*' : ' ');
+      }
+      printf("\n");
+    }
+  }
+}
+
+int timingMain(int argc, char **argv)
+{
+  uint32_t fps = argc > 0 ? strtoul(argv[0], NULL, 0) : TARGET_FPS;
+  uint32_t draw_us = argc > 1 ? strtoul(argv[1], NULL, 0) : 0;
+  uint32_t encode_us = argc > 2 ? strtoul(argv[2], NULL, 0) : 0;
+  if(fps == 0)
+  {
+    fprintf(stderr, "timing: fps must be greater than 0\n");
+    return 1;
+  }
+
+  printStrandTable(fps, draw_us, encode_us);
+
+  uint32_t wire_us = wireFrameUs(Strand::leds_per_channel, Strand::config);
+  printf("\nthis build: %u LEDs on %u segments, %u per output, %u us on the wire (%u transfer, %u latch), %u fps max\n",
+    Strand::leds, Strand::segments, Strand::leds_per_channel, wire_us,
+    wireTransferUs(Strand::leds_per_channel, Strand::config), WIRE_LATCH_US, wireMaxFps(Strand::leds_per_channel, Strand::config));
+
+  setup();
+  telemetryReset();
+  printf("%-12s %10s %10s %10s %8s\n", "effect", "draw us", "encode us", "frame us", "max fps");
+  bool ok = true;
+  for(uint32_t effect = 0; effect < EffectCount; effect++)
+  {
+    CurrentEffect = effect;
+    for(uint32_t frame = 0; frame < TIMING_FRAMES; frame++)
+    {
+      if(Effects[effect]->stress)
+      {
+        Effects[effect]->stress();
+      }
+      hostAdvanceMicros(FRAME_PERIOD_US);
+      loop();
+    }
+
+    const struct telemetry_stage_stats_s *stages = TelemetryEffects[effect].stages;
+    uint32_t effect_draw_us = argc > 1 ? draw_us : averageStageUs(&stages[TELEMETRY_UPDATE]) + averageStageUs(&stages[TELEMETRY_CLEAR]) + averageStageUs(&stages[TELEMETRY_RENDER]);
+    uint32_t effect_encode_us = argc > 2 ? encode_us : averageStageUs(&stages[TELEMETRY_ENCODE]);
+    uint32_t max_fps = 1000000 / timingFrameUs(Strand::leds_per_channel, Strand::config, effect_draw_us, effect_encode_us);
+    ok = ok && max_fps >= fps;
+    printf("%-12s %10u %10u %10u %7u%c\n", Effects[effect]->name, effect_draw_us, effect_encode_us,
+      timingFrameUs(Strand::leds_per_channel, Strand::config, effect_draw_us, effect_encode_us), max_fps, max_fps < fps ? '*' : ' ');
+  }
+  printf("%s %u fps\n", ok ? "every effect reaches" : "not every effect reaches", fps);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,177 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  tree_check.cpp (native host build)
+  Checks the tree coordinate table and its range lookups, and times a
+  rotating beam found through them against one worked out per LED with
+  float trigonometry, the way an effect would without the table. Heights
+  must only grow along the strand, every ring must start at angle 0, and
+  each band and sector range must hold exactly the LEDs whose table
+  coordinates fall inside it.
+*/
+
+#include <stdio.h>
+#include "config.h"
+#include "frame.h"
+#include "host.h"
+#include "rng.h"
+#include "tree.h"
+
+#define TREE_CHECK_CASES 2000
+
+static bool checkTreeTable()
+{
+  bool ok = true;
+  for(int led = 1; led < FRAME_PIXELS; led++)
+  {
+    ok = ok && Tree_Table.points[led].height >= Tree_Table.points[led - 1].height;
+  }
+  for(uint32_t ring = 0; ring < TREE_RINGS; ring++)
+  {
+    ok = ok && Tree_Table.points[treeRingStart(ring)].angle == 0 && treeRingSize(ring) > 0;
+    for(uint32_t led = treeRingStart(ring); led < treeRingStart(ring + 1); led++)
+    {
+      ok = ok && treeRing(led) == ring;
+    }
+  }
+  return ok && treeRingStart(TREE_RINGS) == FRAME_PIXELS;
+}
+
+//Marks the LEDs the ranges cover, and fails on any covered twice
+static bool markTreeRanges(const struct tree_range_s *ranges, uint32_t count, bool *covered)
+{
+  memset(covered, 0, FRAME_PIXELS * sizeof(covered[0]));
+  for(uint32_t range = 0; range < count; range++)
+  {
+    for(uint32_t led = ranges[range].first; led <= ranges[range].last; led++)
+    {
+      if(led >= FRAME_PIXELS || covered[led])
+      {
+        return false;
+      }
+      covered[led] = true;
+    }
+  }
+  return true;
+}
+
+static bool checkTreeRanges(struct rng_s *rng)
+{
+  static bool covered[FRAME_PIXELS];
+  struct tree_range_s ranges[TREE_MAX_SECTOR_RANGES];
+  bool ok = true;
+  for(int test = 0; test < TREE_CHECK_CASES; test++)
+  {
+    uint16_t low = rngNext(rng), high = rngNext(rng);
+    uint32_t count = treeHeightRange(low, high, &ranges[0]) ? 1 : 0;
+    ok = ok && markTreeRanges(ranges, count, covered);
+    for(int led = 0; led < FRAME_PIXELS; led++)
+    {
+      uint16_t height = Tree_Table.points[led].height;
+      ok = ok && covered[led] == (height >= low && height < high);
+    }
+
+    uint16_t start = rngNext(rng), width = rngNext(rng);
+    count = treeSectorRanges(start, width, ranges);
+    ok = ok && count <= TREE_MAX_SECTOR_RANGES && markTreeRanges(ranges, count, covered);
+    for(int led = 0; led < FRAME_PIXELS; led++)
+    {
+      uint16_t from_start = Tree_Table.points[led].angle - start;
+      ok = ok && covered[led] == (from_start < width);
+    }
+  }
+  return ok;
+}
+
+//A quarter turn wide beam, lit the long way: each LED's position worked out from its index and tested with trigonometry
+static void floatBeam(uint32_t *pixels, float beam)
+{
+  int led = 0;
+  for(uint32_t ring = 0; ring < TREE_RINGS; ring++)
+  {
+    uint32_t size = treeRingSize(ring);
+    for(uint32_t offset = 0; offset < size; offset++, led++)
+    {
+      float angle = 2 * (float)M_PI * offset / size;
+      pixels[led] = cosf(angle - beam) > 0.70710678f ? 0xFFFFFF : 0;
+    }
+  }
+}
+
+static void tableBeam(uint32_t *pixels, uint16_t beam)
+{
+  struct tree_range_s ranges[TREE_MAX_SECTOR_RANGES];
+  uint32_t count = treeSectorRanges(beam - 0x2000, 0x4000, ranges);
+  memset(pixels, 0, FRAME_PIXELS * sizeof(pixels[0]));
+  for(uint32_t range = 0; range < count; range++)
+  {
+    for(uint32_t led = ranges[range].first; led <= ranges[range].last; led++)
+    {
+      pixels[led] = 0xFFFFFF;
+    }
+  }
+}
+
+int treeCheckMain(int argc, char **argv)
+{
+  uint32_t frames = argc > 0 ? strtoul(argv[0], NULL, 0) : 20000;
+  if(frames == 0)
+  {
+    fprintf(stderr, "tree: frames must be greater than 0\n");
+    return 1;
+  }
+
+  struct rng_s rng;
+  rngBegin(1);
+  rngStream(&rng, "tree");
+  bool table_ok = checkTreeTable();
+  bool ranges_ok = checkTreeRanges(&rng);
+
+  static uint32_t float_pixels[FRAME_PIXELS], table_pixels[FRAME_PIXELS];
+  uint32_t differing = 0;
+  uint64_t float_ns = 0, table_ns = 0;
+  for(uint32_t frame = 0; frame < frames; frame++)
+  {
+    uint16_t beam = frame * 97;
+    uint64_t start = hostNanos();
+    floatBeam(float_pixels, beam * 2 * (float)M_PI / 65536);
+    float_ns += hostNanos() - start;
+    start = hostNanos();
+    tableBeam(table_pixels, beam);
+    table_ns += hostNanos() - start;
+    for(int led = 0; led < FRAME_PIXELS; led++)
+    {
+      differing += float_pixels[led] != table_pixels[led];
+    }
+  }
+
+  printf("%d LEDs on %u rings, %u bytes of table\n", FRAME_PIXELS, (uint32_t)TREE_RINGS, (uint32_t)sizeof(Tree_Table));
+  printf("table              %s\n", table_ok ? "ok" : "FAILED");
+  printf("band and sector    %s, %d cases\n", ranges_ok ? "ok" : "FAILED", TREE_CHECK_CASES);
+  printf("float beam   %10llu ns/frame\n", (unsigned long long)(float_ns / frames));
+  printf("table beam   %10llu ns/frame\n", (unsigned long long)(table_ns / frames));
+  printf("beams differ on %.3f%% of LEDs\n", 100.0 * differing / ((double)frames * FRAME_PIXELS));
+  return table_ok && ranges_ok ? 0 : 1;
+}
@@ -29,15 +29,23 @@ SOFTWARE.
 */
 
 #include <Arduino.h>
+#include "blend.h"
 #include "config.h"
-
-#define BASE_BRIGHTNESS 4
-#define MAX_BRIGHTNESS  128
-
-#define MAX_SPOTLIGHTS  8
+#include "effect.h"
+#include "fixed.h"
+#include "frame.h"
+#include "particle_pool.h"
+#include "rng.h"
+#include "tree.h"
+
+//Brightness values are perceptual; the encode stage applies the gamma curve.
+#define BASE_BRIGHTNESS 39
+#define MAX_BRIGHTNESS  186
+
+#define MAX_SPOTLIGHTS  (FRAME_PIXELS > 150 ? FRAME_PIXELS * 8 / 150 : 8) //8 for every 150 LEDs
 #define SPOTLIGHT_MIN_SPAWN_TIME    1000
 #define SPOTLIGHT_MAX_SPAWN_TIME    3000
-#define SPOTLIGHT_BRIGHTNESS_OFFSET 80
+#define SPOTLIGHT_BRIGHTNESS_OFFSET 115
 #define SPOTLIGHT_INTENSITY_RAMP_TIME   1500
 #define SPOTLIGHT_SPEED_RAMP_TIME       1500
 #define SPOTLIGHT_MIN_RADIUS  8
@@ -47,183 +55,190 @@ SOFTWARE.
 #define SPOTLIGHT_MIN_SPEED 1
 #define SPOTLIGHT_MAX_SPEED 3
 
-const uint32_t Stripe_Sizes[] =
+//Spotlight fields, indexed by pool slot
+static ParticlePool<MAX_SPOTLIGHTS> Spotlights;
+static fixed_t Spotlight_Position[MAX_SPOTLIGHTS];
+static fixed_t Spotlight_Intensity[MAX_SPOTLIGHTS]; //The light intensity, which is a value between 0 and SPOTLIGHT_BRIGHTNESS_OFFSET
+static uint32_t Spotlight_Radius[MAX_SPOTLIGHTS]; // The size of the spotlight
+static fixed_t Spotlight_Velocity[MAX_SPOTLIGHTS]; // In LEDs per second
+static int Spotlight_Lifetime_Left[MAX_SPOTLIGHTS]; // The amount of time, in milliseconds, the spotlight has left to live
+static int32_t Spotlight_Intensity_Ramp_Time[MAX_SPOTLIGHTS]; // The time it takes, in milliseconds, for the intensity to reach the max value from 0
+static int32_t Spotlight_Speed_Ramp_Time[MAX_SPOTLIGHTS]; // The time it takes, in milliseconds, for the travel speed to reach the max value from minimum value
+static int8_t Spotlight_Ramp_Direction[MAX_SPOTLIGHTS]; // 0 => no growth; 1 => positive growth; -1 => negative growth
+static int Spotlight_Spawn_Alarm; // Time, in milliseconds, until the next spotlight spawns
+static struct rng_s Spotlight_Rng;
+
+static void resetCandyCane()
 {
-    26, 23, 21, 19, 17, 15, 12, 10, 7
-};
-
-struct spotlight_s
-{
-    float position;
-    int8_t intensity; //The light intensity, which is a value between 0 and SPOTLIGHT_BRIGHTNESS_OFFSET
-    uint32_t radius; // The size of the spotlight. If 0, the spotlight is not active
-    float current_velocity;
-    int lifetime_left; // The amount of time, in milliseconds, the spotlight has left to live
-    uint32_t intensity_ramp_time; // The time it takes, in milliseconds, for the intensity to reach the max value from 0
-    uint32_t speed_ramp_time; // The time it takes, in milliseconds, for the travel speed to reach the max value from minimum value
-    int8_t ramp_direction; // 0 => no growth; 1 => positive growth; -1 => negative growth
-};
-
-struct spotlight_s Spotlights[MAX_SPOTLIGHTS] = {0};
-int Spotlight_Spawn_Alarm = 0;
+    rngStream(&Spotlight_Rng, "candy_cane");
+    Spotlights.clear();
+    Spotlight_Spawn_Alarm = 0;
+}
 
-void drawCandyCane()
+//Guards the ramp rate divisions against a ramp that has already run out. A
+//negative one, from a spotlight with under 200 ms left, holds its intensity.
+static inline int32_t rampTime(int32_t ramp_time)
 {
-    static uint32_t last_millis = 0;
-    delay(30);
-    uint32_t current_millis = millis();
-
-    //Draw the white and red lines.
-    int pixel = 0;
-    for(int stripe = 0; stripe < sizeof(Stripe_Sizes) / sizeof(uint32_t); stripe++)
+    if(ramp_time == 0)
     {
-        int color = (stripe % 2) ? (BASE_BRIGHTNESS | (BASE_BRIGHTNESS << 8) | (BASE_BRIGHTNESS << 16)) : (BASE_BRIGHTNESS << 8);
-        for(int stripe_pixel = 0; stripe_pixel < Stripe_Sizes[stripe]; stripe_pixel++, pixel++)
-        {
-            Octo->setPixel(pixel, color);
-        }
+        return 1;
     }
+    return ramp_time < 0 ? INT32_MAX : ramp_time;
+}
 
+static bool updateCandyCane(uint32_t elapsed_millis)
+{
     //Create a new spotlight if the alarm expires
-    if(Spotlight_Spawn_Alarm <= current_millis)
+    Spotlight_Spawn_Alarm = Spotlight_Spawn_Alarm > (int)elapsed_millis ? Spotlight_Spawn_Alarm - (int)elapsed_millis : 0;
+    if(Spotlight_Spawn_Alarm <= 0)
     {
-        for(int spotlight = 0; spotlight < MAX_SPOTLIGHTS; spotlight++)
+        uint16_t spotlight = Spotlights.spawn();
+        if(spotlight != PARTICLE_POOL_NONE)
         {
-            if(Spotlights[spotlight].radius == 0)
+            Spotlight_Position[spotlight] = intToFixed(rngBelow(&Spotlight_Rng, FRAME_PIXELS));
+            Spotlight_Intensity[spotlight] = 0;
+            Spotlight_Radius[spotlight] = rngBetween(&Spotlight_Rng, SPOTLIGHT_MIN_RADIUS, SPOTLIGHT_MAX_RADIUS);
+            Spotlight_Lifetime_Left[spotlight] = rngBetween(&Spotlight_Rng, SPOTLIGHT_MIN_LIFETIME, SPOTLIGHT_MAX_LIFETIME);
+            Spotlight_Velocity[spotlight] = intToFixed(Spotlight_Lifetime_Left[spotlight] % 2 ? SPOTLIGHT_MIN_SPEED : -SPOTLIGHT_MIN_SPEED);
+            Spotlight_Ramp_Direction[spotlight] = 1;
+            if(Spotlight_Lifetime_Left[spotlight] < SPOTLIGHT_INTENSITY_RAMP_TIME * 2)
             {
-                Spotlights[spotlight].position = random(0, MAX_LEDS_PER_CHANNEL);
-                Spotlights[spotlight].intensity = 0;
-                Spotlights[spotlight].radius = random(SPOTLIGHT_MIN_RADIUS, SPOTLIGHT_MAX_RADIUS + 1);
-                Spotlights[spotlight].lifetime_left = random(SPOTLIGHT_MIN_LIFETIME, SPOTLIGHT_MAX_LIFETIME + 1);
-                Spotlights[spotlight].current_velocity = Spotlights[spotlight].lifetime_left % 2 ? SPOTLIGHT_MIN_SPEED : -SPOTLIGHT_MIN_SPEED;
-                Spotlights[spotlight].ramp_direction = 1;
-                if(Spotlights[spotlight].lifetime_left < SPOTLIGHT_INTENSITY_RAMP_TIME * 2)
-                {
-                    Spotlights[spotlight].intensity_ramp_time = Spotlights[spotlight].lifetime_left / 2;
-                }
-                else
-                {
-                    Spotlights[spotlight].intensity_ramp_time = SPOTLIGHT_INTENSITY_RAMP_TIME;
-                }
-                if(Spotlights[spotlight].lifetime_left < SPOTLIGHT_SPEED_RAMP_TIME * 2)
-                {
-                    Spotlights[spotlight].speed_ramp_time = Spotlights[spotlight].lifetime_left / 2;
-                }
-                else
-                {
-                    Spotlights[spotlight].speed_ramp_time = SPOTLIGHT_SPEED_RAMP_TIME;
-                }
-                Spotlight_Spawn_Alarm = current_millis + random(SPOTLIGHT_MIN_SPAWN_TIME, SPOTLIGHT_MAX_SPAWN_TIME + 1);
-                //Serial.print("Spotlight "); Serial.print(spotlight); Serial.print(" at pos: "); Serial.println(Spotlights[spotlight].position);
-                break;
+                Spotlight_Intensity_Ramp_Time[spotlight] = Spotlight_Lifetime_Left[spotlight] / 2;
             }
+            else
+            {
+                Spotlight_Intensity_Ramp_Time[spotlight] = SPOTLIGHT_INTENSITY_RAMP_TIME;
+            }
+            if(Spotlight_Lifetime_Left[spotlight] < SPOTLIGHT_SPEED_RAMP_TIME * 2)
+            {
+                Spotlight_Speed_Ramp_Time[spotlight] = Spotlight_Lifetime_Left[spotlight] / 2;
+            }
+            else
+            {
+                Spotlight_Speed_Ramp_Time[spotlight] = SPOTLIGHT_SPEED_RAMP_TIME;
+            }
+            //Serial.print("Spotlight "); Serial.print(spotlight); Serial.print(" at pos: "); Serial.println(Spotlight_Position[spotlight]);
         }
-        Spotlight_Spawn_Alarm = current_millis + random(SPOTLIGHT_MIN_SPAWN_TIME, SPOTLIGHT_MAX_SPAWN_TIME + 1);
+        Spotlight_Spawn_Alarm = rngBetween(&Spotlight_Rng, SPOTLIGHT_MIN_SPAWN_TIME, SPOTLIGHT_MAX_SPAWN_TIME);
     }
 
+    //The stripes never move, so only a live spotlight (or one that dies during this step) changes the picture.
+    bool changed = false;
+
     // Advance the age of the spotlights
-    for(int spotlight = 0; spotlight < MAX_SPOTLIGHTS; spotlight++)
+    for(uint16_t index = 0; index < Spotlights.count();)
     {
-        if(Spotlights[spotlight].radius == 0)
-        {
-            continue;
-        }
-        Spotlights[spotlight].lifetime_left -= current_millis - last_millis;
-        if(Spotlights[spotlight].lifetime_left <= 0)
+        uint16_t spotlight = Spotlights.slot(index);
+        changed = true;
+        Spotlight_Lifetime_Left[spotlight] -= elapsed_millis;
+        if(Spotlight_Lifetime_Left[spotlight] <= 0)
         {
-            Spotlights[spotlight].radius = 0;
+            Spotlights.free(index); //The last live spotlight moves into this index, so it is visited next
             //Serial.print("Spotlight died by age: "); Serial.println(spotlight);
-            //Serial.print("Sample time delta: "); Serial.println(current_millis - last_millis);
+            //Serial.print("Sample time delta: "); Serial.println(elapsed_millis);
             continue;
         }
 
-        Spotlights[spotlight].position += Spotlights[spotlight].current_velocity * ((current_millis - last_millis) / 1000.0);
-        if(Spotlights[spotlight].position - Spotlights[spotlight].radius > MAX_LEDS_PER_CHANNEL - 1 ||
-            Spotlights[spotlight].position + Spotlights[spotlight].radius < 0)
+        Spotlight_Position[spotlight] += fixedMul(Spotlight_Velocity[spotlight], millisToFixedSeconds(elapsed_millis));
+        if(Spotlight_Position[spotlight] > intToFixed(FRAME_PIXELS - 1 + Spotlight_Radius[spotlight]) ||
+            Spotlight_Position[spotlight] < -intToFixed(Spotlight_Radius[spotlight]))
         {   //If the spotlight is out of sight, delete it and move on to the next spotlight.
-            Spotlights[spotlight].radius = 0;
+            Spotlights.free(index);
             //Serial.print("Spotlight died by travel: "); Serial.println(spotlight);
             continue;
         }
 
-        if(Spotlights[spotlight].ramp_direction != 0)
+        if(Spotlight_Ramp_Direction[spotlight] != 0)
         {
             // change velocity
-            float velocity_step = (SPOTLIGHT_MAX_SPEED / ((float)Spotlights[spotlight].speed_ramp_time) * (current_millis - last_millis));
-            velocity_step *= Spotlights[spotlight].ramp_direction;
-            Spotlights[spotlight].current_velocity += velocity_step;
-            if(abs(Spotlights[spotlight].current_velocity) >= SPOTLIGHT_MAX_SPEED)
+            fixed_t velocity_step = intToFixed(SPOTLIGHT_MAX_SPEED) / rampTime(Spotlight_Speed_Ramp_Time[spotlight]) * (int32_t)elapsed_millis;
+            velocity_step *= Spotlight_Ramp_Direction[spotlight];
+            Spotlight_Velocity[spotlight] = fixedAddSat(Spotlight_Velocity[spotlight], velocity_step);
+            if(fixedAbs(Spotlight_Velocity[spotlight]) >= intToFixed(SPOTLIGHT_MAX_SPEED))
             {
-                Spotlights[spotlight].current_velocity = Spotlights[spotlight].current_velocity > 0 ? SPOTLIGHT_MAX_SPEED : -SPOTLIGHT_MAX_SPEED;
+                Spotlight_Velocity[spotlight] = intToFixed(Spotlight_Velocity[spotlight] > 0 ? SPOTLIGHT_MAX_SPEED : -SPOTLIGHT_MAX_SPEED);
             }
-            else if(abs(Spotlights[spotlight].current_velocity) < SPOTLIGHT_MIN_SPEED)
+            else if(fixedAbs(Spotlight_Velocity[spotlight]) < intToFixed(SPOTLIGHT_MIN_SPEED))
             {
-                Spotlights[spotlight].current_velocity = Spotlights[spotlight].current_velocity > 0 ? SPOTLIGHT_MIN_SPEED : -SPOTLIGHT_MIN_SPEED;
+                Spotlight_Velocity[spotlight] = intToFixed(Spotlight_Velocity[spotlight] > 0 ? SPOTLIGHT_MIN_SPEED : -SPOTLIGHT_MIN_SPEED);
             }
 
-            // change intensity
-            float intensity_step = (SPOTLIGHT_BRIGHTNESS_OFFSET / ((float)Spotlights[spotlight].intensity_ramp_time) * (current_millis - last_millis));
-            intensity_step *= Spotlights[spotlight].ramp_direction;
-            Spotlights[spotlight].intensity += (int)intensity_step;
-            if(Spotlights[spotlight].intensity < 0)
+            // change intensity. Fractions of a step are kept, so slow ramps at high frame rates still progress.
+            fixed_t intensity_step = intToFixed(SPOTLIGHT_BRIGHTNESS_OFFSET) / rampTime(Spotlight_Intensity_Ramp_Time[spotlight]) * (int32_t)elapsed_millis;
+            intensity_step *= Spotlight_Ramp_Direction[spotlight];
+            Spotlight_Intensity[spotlight] = fixedAddSat(Spotlight_Intensity[spotlight], intensity_step);
+            if(Spotlight_Intensity[spotlight] < 0)
             {
-                Spotlights[spotlight].intensity = 0;
+                Spotlight_Intensity[spotlight] = 0;
             }
-            else if(Spotlights[spotlight].intensity > SPOTLIGHT_BRIGHTNESS_OFFSET)
+            else if(Spotlight_Intensity[spotlight] > intToFixed(SPOTLIGHT_BRIGHTNESS_OFFSET))
             {
-                Spotlights[spotlight].intensity = SPOTLIGHT_BRIGHTNESS_OFFSET;
-                Spotlights[spotlight].ramp_direction = 0;
+                Spotlight_Intensity[spotlight] = intToFixed(SPOTLIGHT_BRIGHTNESS_OFFSET);
+                Spotlight_Ramp_Direction[spotlight] = 0;
                 //Serial.print("Spotlight reached full intensity: "); Serial.println(spotlight);
             }
         }
-        else if(Spotlights[spotlight].lifetime_left < Spotlights[spotlight].intensity_ramp_time)
+        else if(Spotlight_Lifetime_Left[spotlight] < Spotlight_Intensity_Ramp_Time[spotlight])
         {
-            Spotlights[spotlight].ramp_direction = -1;
-            Spotlights[spotlight].intensity_ramp_time = Spotlights[spotlight].lifetime_left - 200;
+            Spotlight_Ramp_Direction[spotlight] = -1;
+            Spotlight_Intensity_Ramp_Time[spotlight] = Spotlight_Lifetime_Left[spotlight] - 200;
         }
+        index++;
     }
 
-    //Render each spotlight
-    for(int spotlight = 0; spotlight < MAX_SPOTLIGHTS; spotlight++)
+    return changed;
+}
+
+//Draws the white and red lines, one per ring of the tree, which stay put under the spotlights.
+static void drawCandyCaneStripes(uint32_t * layer)
+{
+    for(uint32_t ring = 0; ring < TREE_RINGS; ring++)
     {
-        if(Spotlights[spotlight].radius == 0)
+        int color = (ring % 2) ? (BASE_BRIGHTNESS | (BASE_BRIGHTNESS << 8) | (BASE_BRIGHTNESS << 16)) : (BASE_BRIGHTNESS << 8);
+        for(uint32_t pixel = treeRingStart(ring); pixel < treeRingStart(ring + 1); pixel++)
         {
-            continue;
+            layer[pixel] = color;
         }
-        int first_led = (int)Spotlights[spotlight].position - Spotlights[spotlight].radius;
-        int last_led = first_led + 2 * Spotlights[spotlight].radius;
-        if(first_led < 0)
-            first_led = 0;
-        if(last_led >= MAX_LEDS_PER_CHANNEL)
-            last_led = MAX_LEDS_PER_CHANNEL - 1;
-
-        for(int led = first_led; led <= last_led; led++)
-        {
-            int color_mask;
-            if((Octo->getPixel(led) & 0xFF) == 0)
-            {
-                color_mask = 0xFF00;
-            }
-            else
-            {
-                color_mask = 0xFFFFFF;
-            }
-            int brightness = -(Spotlights[spotlight].intensity/(float)Spotlights[spotlight].radius)*abs(led - Spotlights[spotlight].position) + Spotlights[spotlight].intensity;
-            brightness += (Octo->getPixel(led) & 0xFF00) >> 8;
-            if(brightness > MAX_BRIGHTNESS)
-            {
-                brightness = MAX_BRIGHTNESS;
-            }
-            else if(brightness < BASE_BRIGHTNESS)
-            {
-                continue;
-            }
+    }
+}
 
-            brightness = brightness | (brightness << 8) | (brightness << 16);
-            brightness &= color_mask;
-            Octo->setPixel(led, brightness);
+static void renderCandyCane()
+{
+    //Render each spotlight
+    for(uint16_t index = 0; index < Spotlights.count(); index++)
+    {
+        uint16_t spotlight = Spotlights.slot(index);
+        // The brightness falls off linearly from the center; the slope is worked out once per spotlight.
+        fixed_t slope = Spotlight_Intensity[spotlight] / (int32_t)Spotlight_Radius[spotlight];
+        int first_led = fixedToInt(Spotlight_Position[spotlight]) - Spotlight_Radius[spotlight];
+        int count;
+        uint32_t *pixels = frameSpan(first_led, first_led + 2 * Spotlight_Radius[spotlight], &count);
+        fixed_t distance = intToFixed(pixels - Frame) - Spotlight_Position[spotlight];
+
+        for(int led = 0; led < count; led++, distance += FIXED_ONE)
+        {
+            int brightness = fixedToInt(Spotlight_Intensity[spotlight] - fixedMul(slope, fixedAbs(distance)));
+            brightness &= ~(brightness >> 31); //The edges of the falloff can dip below 0
+            //Light lands on the white stripes as white and on the others (no blue) as green, and stacks up to MAX_BRIGHTNESS
+            uint32_t color_mask = (pixels[led] & 0xFF) ? 0xFFFFFF : 0x00FF00;
+            uint32_t light = (brightness * 0x010101) & color_mask;
+            pixels[led] = blendMin(blendAdd(pixels[led], light), MAX_BRIGHTNESS * 0x010101);
         }
     }
+}
 
-    last_millis = current_millis;
+static void stressCandyCane()
+{
+    Spotlight_Spawn_Alarm = 0;
 }
+
+extern const struct effect_s CandyCane =
+{
+    "candy_cane",
+    resetCandyCane,
+    updateCandyCane,
+    renderCandyCane,
+    drawCandyCaneStripes,
+    stressCandyCane,
+    NULL
+};
@@ -33,90 +33,112 @@ SOFTWARE.
 */
 
 #include <Arduino.h>
+#include "blend.h"
 #include "config.h"
+#include "effect.h"
+#include "fixed.h"
+#include "frame.h"
+#include "particle_pool.h"
+#include "rng.h"
 
-struct line_s
-{
-  float position;
-  int size; // In LEDs
-  int color;
-  float speed; //In LEDs per second
-};
-
-const int Max_Lines = 20;
+const int Max_Lines = FRAME_PIXELS > 150 ? FRAME_PIXELS * 20 / 150 : 20; //20 for every 150 LEDs, so long strands fill up as densely
 const int Min_Line_Size = 5;
 const int Max_Line_Size = 15;
 const uint32_t Min_Line_Spawn_Alarm = 1000; //The minimum time, in milliseconds, between two line spawns.
 const uint32_t Max_Line_Spawn_Alarm = 4000; //The maximum time, in milliseconds, between two line spawns.
-const float Max_Line_Speed = 25;
-const float Min_Line_Speed = 4;
+const int Max_Line_Speed = 25;
+const int Min_Line_Speed = 4;
+
+//Line fields, indexed by pool slot
+static ParticlePool<Max_Lines> Lines;
+static fixed_t Line_Position[Max_Lines];
+static int Line_Size[Max_Lines]; // In LEDs
+static int Line_Color[Max_Lines];
+static fixed_t Line_Speed[Max_Lines]; //In LEDs per second
+static uint32_t LineSpawnAlarm; //Time, in milliseconds, until the next line may spawn
+static struct rng_s Line_Rng;
+
+static void resetLineDance()
+{
+  rngStream(&Line_Rng, "line_dance");
+  Lines.clear();
+  LineSpawnAlarm = 0;
+}
 
-struct line_s Lines[Max_Lines] = {0};
-int LineCount;
-uint32_t LineSpawnAlarm = 0;
-void drawLineDance()
+static void spawnLine()
+{
+  uint16_t line = Lines.spawn();
+  if(line == PARTICLE_POOL_NONE)
+  {
+    return;
+  }
+  Line_Position[line] = 0;
+  Line_Size[line] = rngBetween(&Line_Rng, Min_Line_Size, Max_Line_Size);
+  Line_Color[line] = 0xFF << (rngBelow(&Line_Rng, 3) * 8); //Red, Green, or Blue
+  Line_Speed[line] = rngBetween(&Line_Rng, intToFixed(Min_Line_Speed), intToFixed(Max_Line_Speed)); //Any speed in between, not just whole LEDs per second
+  LineSpawnAlarm = rngBetween(&Line_Rng, Min_Line_Spawn_Alarm, Max_Line_Spawn_Alarm);
+}
+
+static bool updateLineDance(uint32_t dt)
 {
-  static uint32_t last_millis = 0;
-  uint32_t current_millis = millis();
+  fixed_t elapsed = millisToFixedSeconds(dt);
 
-  if(current_millis >= LineSpawnAlarm && LineCount < Max_Lines) //If it's time to spawn a new line, do so
+  LineSpawnAlarm = LineSpawnAlarm > dt ? LineSpawnAlarm - dt : 0;
+  if(LineSpawnAlarm == 0 && !Lines.full()) //If it's time to spawn a new line, do so
   {
-    for(int line_index = 0; line_index < Max_Lines && LineCount < Max_Lines; line_index++)
-    {
-      if(Lines[line_index].size == 0)
-      {
-        Lines[line_index].position = 0;
-        Lines[line_index].size = random(Min_Line_Size, Max_Line_Size + 1);
-        Lines[line_index].color = 0xFF << (random(0, 3) * 8); //Red, Green, or Blue
-        Lines[line_index].speed = random(Min_Line_Speed * 1000, Max_Line_Speed * 1000 + 1) / 1000;
-        LineSpawnAlarm = current_millis + random(Min_Line_Spawn_Alarm, Max_Line_Spawn_Alarm + 1);
-        LineCount++;
-        break;
-      }
-    }
+    spawnLine();
   }
 
-  for(int line_index = 0; line_index < Max_Lines; line_index++) //Draw each line
+  //Lines that crawl off during this step still have to be erased, so any line counts as a change.
+  bool changed = Lines.count() > 0;
+  for(uint16_t index = 0; index < Lines.count();)
   {
-    if(Lines[line_index].size == 0) //Skip line if it's not instantiated.
+    uint16_t line = Lines.slot(index);
+    Line_Position[line] = fixedAddSat(Line_Position[line], fixedMul(Line_Speed[line], elapsed));
+    if(Line_Position[line] >= intToFixed(FRAME_PIXELS + Line_Size[line])) //If the line has crawled off, delete it
     {
+      Lines.free(index);
       continue;
     }
-    Lines[line_index].position += Lines[line_index].speed * (current_millis - last_millis) / 1000.0;
-    if(Lines[line_index].position - Lines[line_index].size >= MAX_LEDS_PER_CHANNEL) //If the line has crawled off, delete it
-    {
-      Lines[line_index].size = 0;
-      LineCount--;
-      continue;
-    }
-
-    int head_led = (int)Lines[line_index].position;
-    int head_fade = (int)((Lines[line_index].position - head_led) * (Lines[line_index].color + 1)); //Calculates the fade intensity of the head LED
-    head_fade &= Lines[line_index].color;
-    int tail_led = head_led - Lines[line_index].size;
-    int tail_fade = Lines[line_index].color - head_fade; //Calculates the fade intensity of the last LED
-
-    int aux_led = Octo->getPixel(head_led);
-    if(head_fade > (aux_led & Lines[line_index].color))
-    {
-      aux_led &= ~Lines[line_index].color;
-      aux_led |= head_fade;
-    }
-    Octo->setPixel(head_led, aux_led);
-
-    aux_led = Octo->getPixel(tail_led);
-    if(tail_fade > (aux_led & Lines[line_index].color))
-    {
-      aux_led &= ~Lines[line_index].color;
-      aux_led |= tail_fade;
-    }
-    Octo->setPixel(tail_led, aux_led);
+    index++;
+  }
+  return changed;
+}
 
-    for(int led = tail_led + 1; led < head_led; led++) //Everything between the head and tail LEDs are at full brightness
-    {
-      Octo->setPixel(led, Lines[line_index].color | Octo->getPixel(led));
-    }
+static void renderLineDance()
+{
+  for(uint16_t index = 0; index < Lines.count(); index++) //Draw each line
+  {
+    uint16_t line = Lines.slot(index);
+    int color = Line_Color[line];
+    int head_led = fixedToInt(Line_Position[line]);
+    int head_fade = (int)((fixedFraction(Line_Position[line]) * ((int64_t)color + 1)) >> FIXED_SHIFT); //Calculates the fade intensity of the head LED
+    head_fade &= color;
+    int tail_led = head_led - Line_Size[line];
+    int tail_fade = color - head_fade; //Calculates the fade intensity of the last LED
+
+    //Where lines overlap, each channel takes the brightest of them
+    frameSetPixel(head_led, blendMax(frameGetPixel(head_led), head_fade));
+    frameSetPixel(tail_led, blendMax(frameGetPixel(tail_led), tail_fade));
+
+    int count;
+    uint32_t *body = frameSpan(tail_led + 1, head_led - 1, &count); //Everything between the head and tail LEDs are at full brightness
+    blendMaxColor(body, color, count);
   }
+}
 
-  last_millis = current_millis;
-}
\ No newline at end of file
+static void stressLineDance()
+{
+  LineSpawnAlarm = 0;
+}
+
+extern const struct effect_s LineDance =
+{
+  "line_dance",
+  resetLineDance,
+  updateLineDance,
+  renderLineDance,
+  NULL,
+  stressLineDance,
+  NULL
+};
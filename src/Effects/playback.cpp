@@ -0,0 +1,108 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  playback.cpp
+  The Playback effect shows the pre-rendered animations in flash, one after
+  another, each decoded straight into Frame a frame at a time (see
+  animation.h). Decoding is all it costs, however heavy the effect the
+  animation was recorded from.
+*/
+
+#include <Arduino.h>
+#include "animation.h"
+#include "config.h"
+#include "effect.h"
+#include "frame.h"
+
+extern const struct animation_s Line_Dance_Demo;
+
+static const struct animation_s * const Animations[] =
+{
+  &Line_Dance_Demo
+};
+static const uint32_t Animation_Count = sizeof(Animations) / sizeof(Animations[0]);
+
+static uint32_t Animation; // Index into Animations of the one playing
+static const uint8_t *Next_Frame; // The next frame to decode, NULL until the first
+static uint32_t Hold_Time; // Time, in microseconds, until the next frame is due
+
+static void resetPlayback()
+{
+  Animation = 0;
+  Next_Frame = NULL;
+  Hold_Time = 0;
+}
+
+//Blanks the strand and starts the next animation, or the first one the first time
+static void startAnimation()
+{
+  if(Next_Frame)
+  {
+    Animation = (Animation + 1) % Animation_Count;
+  }
+  Next_Frame = Animations[Animation]->data;
+  memset(Frame, 0, FRAME_PIXELS * sizeof(Frame[0]));
+  frameMarkChanged(0, FRAME_PIXELS - 1);
+}
+
+static bool updatePlayback(uint32_t dt)
+{
+  uint32_t elapsed = dt * 1000;
+  if(Hold_Time > elapsed)
+  {
+    Hold_Time -= elapsed;
+    return false;
+  }
+
+  //At most one frame is decoded per step, so a late step still costs one decode. It catches up over the next steps.
+  uint32_t late = elapsed - Hold_Time;
+  const struct animation_s *animation = Animations[Animation];
+  if(!Next_Frame || Next_Frame >= animation->data + animation->length)
+  {
+    startAnimation();
+    animation = Animations[Animation];
+  }
+  uint32_t hold;
+  Next_Frame = animationDecodeFrame(Next_Frame, animation->leds, &hold);
+  Hold_Time = hold * animation->frame_us;
+  Hold_Time = Hold_Time > late ? Hold_Time - late : 0;
+  return true;
+}
+
+static void renderPlayback()
+{
+  //The frame was decoded straight into Frame, which frameClear() leaves alone as nothing was drawn with frameSetPixel()
+}
+
+extern const struct effect_s Playback =
+{
+  "playback",
+  resetPlayback,
+  updatePlayback,
+  renderPlayback,
+  NULL,
+  NULL,
+  NULL
+};
@@ -0,0 +1,241 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  serial_stream.cpp
+  The Serial Stream effect shows frames sent from a PC over the USB serial
+  port, in the Adalight format most ambient lighting and show control
+  software speaks:
+
+    'A' 'd' 'a' count_hi count_lo checksum R G B R G B ...
+
+  count is the number of LEDs less one and checksum is
+  count_hi ^ count_lo ^ 0x55. A frame with more LEDs than the strand has the
+  rest dropped; one with fewer leaves the rest of the strand black.
+
+  The pixel bytes are read out of the USB buffers straight into Frame, with
+  no buffer of their own: they land packed at the top of Frame, and each
+  whole pixel is widened in place to its 0xRRGGBB word as soon as it is in.
+  Pixel i's word always ends below where pixel i + 1's bytes start, so
+  widening never overwrites bytes that are still to be read. Once a frame is
+  whole nothing more is read until it has been handed to the encoder, which
+  leaves the next frame in the USB buffers, holding the sender back rather
+  than being dropped.
+
+  Between frames, bytes that don't start a header are telemetry commands.
+  After a frame is given up on, everything up to the next good header is
+  skipped instead, as it is most likely the rest of that frame.
+*/
+
+#include <Arduino.h>
+#include "config.h"
+#include "effect.h"
+#include "frame.h"
+#include "telemetry.h"
+
+#define STREAM_HEADER_LENGTH 6
+#define STREAM_MAGIC_LENGTH  3
+
+const uint32_t Stream_Timeout = 250; //Time, in milliseconds, a frame may stall partway before it is given up on
+
+enum stream_state_e
+{
+  STREAM_HEADER, // Matching a header
+  STREAM_PIXELS, // Reading pixel bytes into Frame
+  STREAM_SKIP, // Reading past the LEDs the strand doesn't have
+  STREAM_READY // A whole frame is in Frame, waiting for update()
+};
+
+static const uint8_t Stream_Magic[STREAM_MAGIC_LENGTH] = {'A', 'd', 'a'};
+
+static enum stream_state_e Stream_State;
+static bool Stream_Synced; // The last header was good, so the bytes after a frame can be trusted to be commands
+static uint8_t Stream_Header[STREAM_HEADER_LENGTH];
+static uint32_t Stream_Header_Length; // Header bytes matched so far
+static uint32_t Stream_Leds; // LEDs of the current frame that land in Frame
+static uint32_t Stream_Received; // Pixel bytes of the current frame read so far
+static uint32_t Stream_Widened; // Pixels of the current frame already widened
+static uint32_t Stream_Skip; // Bytes of the current frame left to skip
+static uint32_t Stream_Header_Time; // micros() when the current frame's header was complete
+static uint32_t Stream_Last_Byte; // millis() when the last byte was read
+
+//Where the current frame's pixel bytes land: the top Stream_Leds * 3 bytes of Frame
+static uint8_t * streamBytes()
+{
+  return (uint8_t *)Frame + (FRAME_PIXELS * 4 - Stream_Leds * 3);
+}
+
+static void resyncStream(bool synced)
+{
+  Stream_State = STREAM_HEADER;
+  Stream_Synced = synced;
+  Stream_Header_Length = 0;
+}
+
+static void resetSerialStream()
+{
+  resyncStream(true);
+  Stream_Last_Byte = millis();
+}
+
+static void dropStreamFrame()
+{
+  telemetryStreamDropped();
+  resyncStream(false);
+}
+
+static void readStreamHeader()
+{
+  int c = Serial.read();
+  if(Stream_Header_Length < STREAM_MAGIC_LENGTH && c != Stream_Magic[Stream_Header_Length])
+  {
+    if(Stream_Header_Length == 0 && Stream_Synced)
+    {
+      telemetryCommand(c);
+    }
+    Stream_Header_Length = c == Stream_Magic[0] ? 1 : 0;
+    return;
+  }
+  Stream_Header[Stream_Header_Length++] = c;
+  if(Stream_Header_Length < STREAM_HEADER_LENGTH)
+  {
+    return;
+  }
+
+  if((Stream_Header[3] ^ Stream_Header[4] ^ 0x55) != Stream_Header[5])
+  {
+    dropStreamFrame();
+    return;
+  }
+  uint32_t leds = ((uint32_t)Stream_Header[3] << 8 | Stream_Header[4]) + 1;
+  Stream_Leds = leds < FRAME_PIXELS ? leds : FRAME_PIXELS;
+  Stream_Skip = (leds - Stream_Leds) * 3;
+  Stream_Received = 0;
+  Stream_Widened = 0;
+  Stream_Synced = true;
+  Stream_Header_Time = micros();
+  Stream_State = STREAM_PIXELS;
+}
+
+static void finishStreamFrame()
+{
+  //The strand past the frame's LEDs still holds pixel bytes
+  for(uint32_t led = Stream_Leds; led < FRAME_PIXELS; led++)
+  {
+    Frame[led] = 0;
+  }
+  frameMarkAllDirty();
+  Stream_State = STREAM_READY;
+}
+
+static void readStreamPixels(uint32_t available)
+{
+  uint32_t wanted = Stream_Leds * 3 - Stream_Received;
+  uint32_t length = available < wanted ? available : wanted;
+  uint8_t *bytes = streamBytes();
+  Serial.readBytes((char *)bytes + Stream_Received, length);
+  Stream_Received += length;
+
+  uint32_t whole = Stream_Received / 3;
+  for(uint32_t led = Stream_Widened; led < whole; led++)
+  {
+    const uint8_t *pixel = bytes + led * 3;
+    Frame[led] = (uint32_t)pixel[0] << 16 | (uint32_t)pixel[1] << 8 | pixel[2];
+  }
+  Stream_Widened = whole;
+
+  if(Stream_Received == Stream_Leds * 3)
+  {
+    Stream_State = STREAM_SKIP;
+    if(Stream_Skip == 0)
+    {
+      finishStreamFrame();
+    }
+  }
+}
+
+static void serviceSerialStream()
+{
+  while(Stream_State != STREAM_READY)
+  {
+    int available = Serial.available();
+    if(available <= 0)
+    {
+      bool partway = Stream_State != STREAM_HEADER || Stream_Header_Length > 0;
+      if(partway && millis() - Stream_Last_Byte >= Stream_Timeout)
+      {
+        dropStreamFrame();
+      }
+      return;
+    }
+    Stream_Last_Byte = millis();
+
+    switch(Stream_State)
+    {
+      case STREAM_HEADER:
+        readStreamHeader();
+        break;
+      case STREAM_PIXELS:
+        readStreamPixels(available);
+        break;
+      case STREAM_SKIP:
+        Serial.read();
+        if(--Stream_Skip == 0)
+        {
+          finishStreamFrame();
+        }
+        break;
+      case STREAM_READY:
+        break;
+    }
+  }
+}
+
+static bool updateSerialStream(uint32_t dt)
+{
+  (void)dt;
+  if(Stream_State != STREAM_READY)
+  {
+    return false;
+  }
+  telemetryStreamFrame(micros() - Stream_Header_Time);
+  resyncStream(true);
+  return true;
+}
+
+static void renderSerialStream()
+{
+  //The frame was read straight into Frame, which frameClear() leaves alone as nothing was drawn with frameSetPixel()
+}
+
+extern const struct effect_s SerialStream =
+{
+  "stream",
+  resetSerialStream,
+  updateSerialStream,
+  renderSerialStream,
+  NULL,
+  NULL,
+  serviceSerialStream
+};
@@ -0,0 +1,85 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  animation.cpp
+  Decoder for the delta coded frames of animation.h.
+*/
+
+#include "animation.h"
+#include "frame.h"
+
+//First strand LED shown by animation pixel `pixel`. Pixel p covers the LEDs up to the first of pixel p + 1, which is none when the animation is longer than the strand.
+static inline uint32_t strandLed(uint32_t pixel, uint32_t leds)
+{
+  return pixel * FRAME_PIXELS / leds;
+}
+
+const uint8_t * animationDecodeFrame(const uint8_t *data, uint32_t leds, uint32_t *hold)
+{
+  uint32_t led = 0;
+  while(true)
+  {
+    uint8_t op = *data++;
+    uint32_t length = (op & ~ANIMATION_OP_MASK) + 1;
+    uint32_t end = led + length;
+    uint32_t first = strandLed(led, leds);
+    uint32_t last = strandLed(end < leds ? end : leds, leds); //Runs past the animation's last pixel are still read whole
+    switch(op & ANIMATION_OP_MASK)
+    {
+      case ANIMATION_SKIP:
+        break;
+      case ANIMATION_FILL:
+      {
+        uint32_t color = (uint32_t)data[0] << 16 | (uint32_t)data[1] << 8 | data[2];
+        for(uint32_t pixel = first; pixel < last; pixel++)
+        {
+          Frame[pixel] = color;
+        }
+        data += 3;
+        break;
+      }
+      case ANIMATION_LITERAL:
+        for(uint32_t pixel = led; pixel < end && pixel < leds; pixel++)
+        {
+          const uint8_t *rgb = data + (pixel - led) * 3;
+          uint32_t color = (uint32_t)rgb[0] << 16 | (uint32_t)rgb[1] << 8 | rgb[2];
+          for(uint32_t strand_led = strandLed(pixel, leds); strand_led < strandLed(pixel + 1, leds); strand_led++)
+          {
+            Frame[strand_led] = color;
+          }
+        }
+        data += length * 3;
+        break;
+      case ANIMATION_END:
+        *hold = length;
+        return data;
+    }
+    if(first < last && (op & ANIMATION_OP_MASK) != ANIMATION_SKIP)
+    {
+      frameMarkChanged(first, last - 1);
+    }
+    led = end;
+  }
+}
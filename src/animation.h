@@ -0,0 +1,76 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  animation.h
+  Pre-rendered animations, kept in flash and played back by the Playback
+  effect. The host build's record command renders them from any effect or
+  from raw RGB frames.
+
+  An animation is a byte stream of runs over the strand, each frame coded
+  against the one before it. The first frame is coded against black. Every
+  run starts with an op byte: the top two bits give the kind of run, and the
+  low six bits give its length less one, 1 to ANIMATION_RUN_MAX.
+
+    ANIMATION_SKIP     The next n pixels keep the last frame's color
+    ANIMATION_FILL     R G B follows; the next n pixels are all that color
+    ANIMATION_LITERAL  n R G B triples follow, one per pixel
+    ANIMATION_END      The frame is complete and is shown for n frame periods
+
+  Pixels past a frame's last run keep their color. A frame never writes a
+  pixel twice and has at most one op per pixel, so decoding one costs no more
+  than writing the whole strand once, however the stream was compressed.
+*/
+
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <Arduino.h>
+
+#define ANIMATION_SKIP     0x00
+#define ANIMATION_FILL     0x40
+#define ANIMATION_LITERAL  0x80
+#define ANIMATION_END      0xC0
+#define ANIMATION_OP_MASK  0xC0
+#define ANIMATION_RUN_MAX  64
+
+struct animation_s
+{
+  const char *name;
+  uint16_t leds; // Pixels per frame. Frames are stretched or squeezed to fit the strand
+  uint32_t frame_us; // Length of one frame period
+  uint32_t length; // Bytes of data
+  const uint8_t *data;
+};
+
+/*
+  Decodes the frame starting at data, of an animation `leds` pixels long,
+  into Frame, marking the LEDs it changes with frameMarkChanged(). Each pixel
+  is shown on its share of the strand; when the animation is the longer of
+  the two, pixels that would share an LED drop out. Returns the start of the
+  next frame and sets hold to the number of frame periods to show this one for.
+*/
+const uint8_t * animationDecodeFrame(const uint8_t *data, uint32_t leds, uint32_t *hold);
+
+#endif
@@ -0,0 +1,1298 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  line_dance_demo.cpp
+  Recorded with `program record line_dance 600 line_dance_demo`.
+  600 frames of 150 LEDs at 60 fps, 15045 bytes (270000 raw). Regenerate it rather than editing it.
+*/
+
+#include "animation.h"
+
+static const uint8_t Data[] =
+{
+  0x80, 0x4C, 0x00, 0x00, 0xC0, 0x80, 0x71, 0x00, 0x00, 0xC0, 0x80, 0x99,
+  0x00, 0x00, 0xC0, 0x80, 0xC1, 0x00, 0x00, 0xC0, 0x80, 0xE6, 0x00, 0x00,
+  0xC0, 0x81, 0xFF, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x36,
+  0x00, 0x00, 0xC0, 0x00, 0x80, 0x5B, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x83,
+  0x00, 0x00, 0xC0, 0x00, 0x80, 0xAA, 0x00, 0x00, 0xC0, 0x00, 0x80, 0xCF,
+  0x00, 0x00, 0xC0, 0x00, 0x80, 0xF7, 0x00, 0x00, 0xC0, 0x00, 0x81, 0xFF,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x45, 0x00, 0x00, 0xC0,
+  0x01, 0x80, 0x6C, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x94, 0x00, 0x00, 0xC0,
+  0x01, 0x80, 0xB9, 0x00, 0x00, 0xC0, 0x01, 0x80, 0xE1, 0x00, 0x00, 0xC0,
+  0x01, 0x81, 0xFF, 0x00, 0x00, 0x09, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x2E,
+  0x00, 0x00, 0xC0, 0x02, 0x80, 0x56, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x7D,
+  0x00, 0x00, 0xC0, 0x02, 0x80, 0xA3, 0x00, 0x00, 0xC0, 0x02, 0x80, 0xCA,
+  0x00, 0x00, 0xC0, 0x02, 0x80, 0xF2, 0x00, 0x00, 0xC0, 0x02, 0x81, 0xFF,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x3F, 0x00, 0x00, 0xC0,
+  0x03, 0x80, 0x67, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x8C, 0x00, 0x00, 0xC0,
+  0x03, 0x80, 0xB4, 0x00, 0x00, 0xC0, 0x03, 0x80, 0xDB, 0x00, 0x00, 0xC0,
+  0x03, 0x81, 0xFF, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x29,
+  0x00, 0x00, 0xC0, 0x04, 0x80, 0x51, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x76,
+  0x00, 0x00, 0xC0, 0x04, 0x80, 0x9D, 0x00, 0x00, 0xC0, 0x04, 0x80, 0xC5,
+  0x00, 0x00, 0xC0, 0x04, 0x80, 0xEA, 0x00, 0x00, 0xC0, 0x04, 0x81, 0xFF,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x3A, 0x00, 0x00, 0xC0,
+  0x05, 0x80, 0x5F, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x87, 0x00, 0x00, 0xC0,
+  0x05, 0x80, 0xAF, 0x00, 0x00, 0xC0, 0x05, 0x80, 0xD4, 0x00, 0x00, 0xC0,
+  0x05, 0x80, 0xFB, 0x00, 0x00, 0xC0, 0x05, 0x81, 0xFF, 0x00, 0x00, 0x24,
+  0x00, 0x00, 0xC0, 0x06, 0x80, 0x49, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x71,
+  0x00, 0x00, 0xC0, 0x06, 0x80, 0x98, 0x00, 0x00, 0xC0, 0x06, 0x80, 0xBD,
+  0x00, 0x00, 0xC0, 0x06, 0x80, 0xE5, 0x00, 0x00, 0xC0, 0x06, 0x81, 0xFF,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x33, 0x00, 0x00, 0xC0,
+  0x07, 0x80, 0x5A, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x82, 0x00, 0x00, 0xC0,
+  0x07, 0x80, 0xA7, 0x00, 0x00, 0xC0, 0x07, 0x80, 0xCF, 0x00, 0x00, 0xC0,
+  0x07, 0x80, 0xF6, 0x00, 0x00, 0xC0, 0x07, 0x81, 0xFF, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0xC0, 0x08, 0x80, 0x44, 0x00, 0x00, 0xC0, 0x08, 0x80, 0x6B,
+  0x00, 0x00, 0xC0, 0x08, 0x80, 0x91, 0x00, 0x00, 0xC0, 0x08, 0x80, 0xB8,
+  0x00, 0x00, 0xC0, 0x08, 0x80, 0xE0, 0x00, 0x00, 0xC0, 0x08, 0x81, 0xFF,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x09, 0x80, 0x2E, 0x00, 0x00, 0xC0,
+  0x09, 0x80, 0x55, 0x00, 0x00, 0xC0, 0x09, 0x80, 0x7A, 0x00, 0x00, 0xC0,
+  0x09, 0x80, 0xA2, 0x00, 0x00, 0xC0, 0x09, 0x80, 0xC9, 0x00, 0x00, 0xC0,
+  0x09, 0x80, 0xEF, 0x00, 0x00, 0xC0, 0x09, 0x81, 0xFF, 0x00, 0x00, 0x17,
+  0x00, 0x00, 0xC0, 0x0A, 0x80, 0x3F, 0x00, 0x00, 0xC0, 0x0A, 0x80, 0x64,
+  0x00, 0x00, 0xC0, 0x0A, 0x80, 0x8B, 0x00, 0x00, 0xC0, 0x0A, 0x80, 0xB3,
+  0x00, 0x00, 0xC0, 0x0A, 0x80, 0xD8, 0x00, 0x00, 0xC0, 0x0A, 0x81, 0xFF,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x0B, 0x80, 0x28, 0x00, 0x00, 0xC0,
+  0x0B, 0x80, 0x4E, 0x00, 0x00, 0xC0, 0x0B, 0x80, 0x75, 0x00, 0x00, 0xC0,
+  0x0B, 0x80, 0x9D, 0x00, 0x00, 0xC0, 0x0B, 0x80, 0xC2, 0x00, 0x00, 0xC0,
+  0x0B, 0x80, 0xE9, 0x00, 0x00, 0xC0, 0x80, 0xED, 0x00, 0x00, 0x0A, 0x81,
+  0xFF, 0x00, 0x00, 0x12, 0x00, 0x00, 0xC0, 0x80, 0xC8, 0x00, 0x00, 0x0B,
+  0x80, 0x37, 0x00, 0x00, 0xC0, 0x80, 0xA0, 0x00, 0x00, 0x0B, 0x80, 0x5F,
+  0x00, 0x00, 0xC0, 0x80, 0x79, 0x00, 0x00, 0x0B, 0x80, 0x86, 0x00, 0x00,
+  0xC0, 0x80, 0x54, 0x00, 0x00, 0x0B, 0x80, 0xAB, 0x00, 0x00, 0xC0, 0x80,
+  0x2C, 0x00, 0x00, 0x0B, 0x80, 0xD3, 0x00, 0x00, 0xC0, 0x80, 0x04, 0x00,
+  0x00, 0x0B, 0x80, 0xFB, 0x00, 0x00, 0xC0, 0x81, 0x00, 0x00, 0x00, 0xDE,
+  0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x21, 0x00, 0x00, 0xC0, 0x00,
+  0x80, 0xB7, 0x00, 0x00, 0x0B, 0x80, 0x48, 0x00, 0x00, 0xC0, 0x00, 0x80,
+  0x8F, 0x00, 0x00, 0x0B, 0x80, 0x70, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x6A,
+  0x00, 0x00, 0x0B, 0x80, 0x95, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x42, 0x00,
+  0x00, 0x0B, 0x80, 0xBD, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x1B, 0x00, 0x00,
+  0x0B, 0x80, 0xE4, 0x00, 0x00, 0xC0, 0x00, 0x81, 0x00, 0x00, 0x00, 0xF5,
+  0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xC0, 0x01,
+  0x80, 0xCD, 0x00, 0x00, 0x0B, 0x80, 0x32, 0x00, 0x00, 0xC0, 0x01, 0x80,
+  0xA6, 0x00, 0x00, 0x0B, 0x80, 0x59, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x80,
+  0x00, 0x00, 0x0B, 0x80, 0x7F, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x59, 0x00,
+  0x00, 0x0B, 0x80, 0xA6, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x31, 0x00, 0x00,
+  0x0B, 0x80, 0xCE, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x0C, 0x00, 0x00, 0x0B,
+  0x80, 0xF3, 0x00, 0x00, 0xC0, 0x01, 0x81, 0x00, 0x00, 0x00, 0xE3, 0x00,
+  0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xC0, 0x02, 0x80,
+  0xBC, 0x00, 0x00, 0x0B, 0x80, 0x43, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x97,
+  0x00, 0x00, 0x0B, 0x80, 0x68, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x6F, 0x00,
+  0x00, 0x0B, 0x80, 0x90, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x48, 0x00, 0x00,
+  0x0B, 0x80, 0xB7, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x22, 0x00, 0x00, 0x0B,
+  0x80, 0xDD, 0x00, 0x00, 0xC0, 0x02, 0x81, 0x00, 0x00, 0x00, 0xFA, 0x00,
+  0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0xC0, 0x03, 0x80,
+  0xD2, 0x00, 0x00, 0x0B, 0x80, 0x2D, 0x00, 0x00, 0xC0, 0x03, 0x80, 0xAD,
+  0x00, 0x00, 0x0B, 0x80, 0x52, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x86, 0x00,
+  0x00, 0x0B, 0x80, 0x79, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x5E, 0x00, 0x00,
+  0x0B, 0x80, 0xA1, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x39, 0x00, 0x00, 0x0B,
+  0x80, 0xC6, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x11, 0x00, 0x00, 0x0B, 0x80,
+  0xEE, 0x00, 0x00, 0xC0, 0x03, 0x81, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00,
+  0x0A, 0x81, 0xFF, 0x00, 0x00, 0x16, 0x00, 0x00, 0xC0, 0x04, 0x80, 0xC3,
+  0x00, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x9C, 0x00,
+  0x00, 0x0B, 0x80, 0x63, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x74, 0x00, 0x00,
+  0x0B, 0x80, 0x8B, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x4F, 0x00, 0x00, 0x0B,
+  0x80, 0xB0, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x28, 0x00, 0x00, 0x0B, 0x80,
+  0xD7, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xFF,
+  0x00, 0x00, 0xC0, 0x05, 0x80, 0xDA, 0x00, 0x00, 0x0B, 0x80, 0x25, 0x00,
+  0x00, 0xC0, 0x05, 0x80, 0xB2, 0x00, 0x00, 0x0B, 0x80, 0x4D, 0x00, 0x00,
+  0xC0, 0x05, 0x80, 0x8B, 0x00, 0x00, 0x0B, 0x80, 0x74, 0x00, 0x00, 0xC0,
+  0x05, 0x80, 0x66, 0x00, 0x00, 0x0B, 0x80, 0x99, 0x00, 0x00, 0xC0, 0x05,
+  0x80, 0x3E, 0x00, 0x00, 0x0B, 0x80, 0xC1, 0x00, 0x00, 0xC0, 0x05, 0x80,
+  0x16, 0x00, 0x00, 0x0B, 0x80, 0xE9, 0x00, 0x00, 0xC0, 0x05, 0x81, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0xC0, 0x06, 0x80, 0xC9, 0x00, 0x00, 0x0B, 0x80, 0x36, 0x00, 0x00,
+  0xC0, 0x06, 0x80, 0xA1, 0x00, 0x00, 0x0B, 0x80, 0x5E, 0x00, 0x00, 0xC0,
+  0x06, 0x80, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x83, 0x00, 0x00, 0xC0, 0x06,
+  0x80, 0x54, 0x00, 0x00, 0x0B, 0x80, 0xAB, 0x00, 0x00, 0xC0, 0x06, 0x80,
+  0x2D, 0x00, 0x00, 0x0B, 0x80, 0xD2, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x08,
+  0x00, 0x00, 0x0B, 0x80, 0xF7, 0x00, 0x00, 0xC0, 0x06, 0x81, 0x00, 0x00,
+  0x00, 0xDF, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0xC0, 0x07, 0x80, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x47, 0x00, 0x00, 0xC0,
+  0x07, 0x80, 0x92, 0x00, 0x00, 0x0B, 0x80, 0x6D, 0x00, 0x00, 0xC0, 0x07,
+  0x80, 0x6B, 0x00, 0x00, 0x0B, 0x80, 0x94, 0x00, 0x00, 0xC0, 0x07, 0x80,
+  0x43, 0x00, 0x00, 0x0B, 0x80, 0xBC, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x1E,
+  0x00, 0x00, 0x0B, 0x80, 0xE1, 0x00, 0x00, 0xC0, 0x07, 0x81, 0x00, 0x00,
+  0x00, 0xF5, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00,
+  0xC0, 0x08, 0x80, 0xCE, 0x00, 0x00, 0x0B, 0x80, 0x31, 0x00, 0x00, 0xC0,
+  0x08, 0x80, 0xA9, 0x00, 0x00, 0x0B, 0x80, 0x56, 0x00, 0x00, 0xC0, 0x08,
+  0x80, 0x81, 0x00, 0x00, 0x0B, 0x80, 0x7E, 0x00, 0x00, 0xC0, 0x08, 0x80,
+  0x5A, 0x00, 0x00, 0x0B, 0x80, 0xA5, 0x00, 0x00, 0xC0, 0x08, 0x80, 0x34,
+  0x00, 0x00, 0x0B, 0x80, 0xCB, 0x00, 0x00, 0xC0, 0x08, 0x80, 0x0D, 0x00,
+  0x00, 0x0B, 0x80, 0xF2, 0x00, 0x00, 0xC0, 0x08, 0x81, 0x00, 0x00, 0x00,
+  0xE4, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x1B, 0x00, 0x00, 0xC0,
+  0x09, 0x80, 0xBF, 0x00, 0x00, 0x0B, 0x80, 0x40, 0x00, 0x00, 0xC0, 0x09,
+  0x80, 0x98, 0x00, 0x00, 0x0B, 0x80, 0x67, 0x00, 0x00, 0xC0, 0x09, 0x80,
+  0x70, 0x00, 0x00, 0x0B, 0x80, 0x8F, 0x00, 0x00, 0xC0, 0x09, 0x80, 0x4B,
+  0x00, 0x00, 0x0B, 0x80, 0xB4, 0x00, 0x00, 0xC0, 0x09, 0x80, 0x23, 0x00,
+  0x00, 0x0B, 0x80, 0xDC, 0x00, 0x00, 0xC0, 0x09, 0x81, 0x00, 0x00, 0x00,
+  0xFB, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x00, 0xC0,
+  0x0A, 0x80, 0xD5, 0x00, 0x00, 0x0B, 0x80, 0x2A, 0x00, 0x00, 0xC0, 0x0A,
+  0x80, 0xAE, 0x00, 0x00, 0x0B, 0x80, 0x51, 0x00, 0x00, 0xC0, 0x0A, 0x80,
+  0x86, 0x00, 0x00, 0x0B, 0x80, 0x79, 0x00, 0x00, 0xC0, 0x0A, 0x80, 0x61,
+  0x00, 0x00, 0x0B, 0x80, 0x9E, 0x00, 0x00, 0xC0, 0x0A, 0x80, 0x3A, 0x00,
+  0x00, 0x0B, 0x80, 0xC5, 0x00, 0x00, 0xC0, 0x0A, 0x80, 0x12, 0x00, 0x00,
+  0x0B, 0x80, 0xED, 0x00, 0x00, 0xC0, 0x0A, 0x81, 0x00, 0x00, 0x00, 0xEC,
+  0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x13, 0x00, 0x00, 0xC0, 0x0B,
+  0x80, 0xC4, 0x00, 0x00, 0x0B, 0x80, 0x3B, 0x00, 0x00, 0xC0, 0x0B, 0x80,
+  0x9D, 0x00, 0x00, 0x0B, 0x80, 0x62, 0x00, 0x00, 0xC0, 0x0B, 0x80, 0x78,
+  0x00, 0x00, 0x0B, 0x80, 0x87, 0x00, 0x00, 0xC0, 0x0B, 0x80, 0x50, 0x00,
+  0x00, 0x0B, 0x80, 0xAF, 0x00, 0x00, 0xC0, 0x0B, 0x80, 0x28, 0x00, 0x00,
+  0x0B, 0x80, 0xD7, 0x00, 0x00, 0xC0, 0x0B, 0x80, 0x03, 0x00, 0x00, 0x0B,
+  0x80, 0xFC, 0x00, 0x00, 0xC0, 0x0B, 0x81, 0x00, 0x00, 0x00, 0xDB, 0x00,
+  0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x24, 0x00, 0x00, 0xC0, 0x0C, 0x80,
+  0xB3, 0x00, 0x00, 0x0B, 0x80, 0x4C, 0x00, 0x00, 0xC0, 0x0C, 0x80, 0x8E,
+  0x00, 0x00, 0x0B, 0x80, 0x71, 0x00, 0x00, 0xC0, 0x0C, 0x80, 0x66, 0x00,
+  0x00, 0x0B, 0x80, 0x99, 0x00, 0x00, 0xC0, 0x0C, 0x80, 0x3F, 0x00, 0x00,
+  0x0B, 0x80, 0xC0, 0x00, 0x00, 0xC0, 0x0C, 0x80, 0x1A, 0x00, 0x00, 0x0B,
+  0x80, 0xE5, 0x00, 0x00, 0xC0, 0x0C, 0x81, 0x00, 0x00, 0x00, 0xF1, 0x00,
+  0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xC0, 0x0D, 0x80,
+  0xC9, 0x00, 0x00, 0x0B, 0x80, 0x36, 0x00, 0x00, 0xC0, 0x0D, 0x80, 0xA4,
+  0x00, 0x00, 0x0B, 0x80, 0x5B, 0x00, 0x00, 0xC0, 0x0D, 0x80, 0x7D, 0x00,
+  0x00, 0x0B, 0x80, 0x82, 0x00, 0x00, 0xC0, 0x0D, 0x80, 0x55, 0x00, 0x00,
+  0x0B, 0x80, 0xAA, 0x00, 0x00, 0xC0, 0x0D, 0x80, 0x30, 0x00, 0x00, 0x0B,
+  0x80, 0xCF, 0x00, 0x00, 0xC0, 0x0D, 0x80, 0x08, 0x00, 0x00, 0x0B, 0x80,
+  0xF7, 0x00, 0x00, 0xC0, 0x0D, 0x81, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0x0A, 0x81, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0, 0x0E, 0x80, 0xBB,
+  0x00, 0x00, 0x0B, 0x80, 0x44, 0x00, 0x00, 0xC0, 0x0E, 0x80, 0x93, 0x00,
+  0x00, 0x0B, 0x80, 0x6C, 0x00, 0x00, 0xC0, 0x0E, 0x80, 0x6C, 0x00, 0x00,
+  0x0B, 0x80, 0x93, 0x00, 0x00, 0xC0, 0x0E, 0x80, 0x46, 0x00, 0x00, 0x0B,
+  0x80, 0xB9, 0x00, 0x00, 0xC0, 0x0E, 0x80, 0x1F, 0x00, 0x00, 0x0B, 0x80,
+  0xE0, 0x00, 0x00, 0xC0, 0x0E, 0x81, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00,
+  0x0A, 0x81, 0xFF, 0x00, 0x00, 0x09, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0xD1,
+  0x00, 0x00, 0x0B, 0x80, 0x2E, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0xA9, 0x00,
+  0x00, 0x0B, 0x80, 0x56, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0x82, 0x00, 0x00,
+  0x0B, 0x80, 0x7D, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0x5D, 0x00, 0x00, 0x0B,
+  0x80, 0xA2, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0x35, 0x00, 0x00, 0x0B, 0x80,
+  0xCA, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0x0E, 0x00, 0x00, 0x0B, 0x80, 0xF1,
+  0x00, 0x00, 0xC0, 0x0F, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x0A,
+  0x81, 0xFF, 0x00, 0x00, 0x18, 0x00, 0x00, 0xC0, 0x10, 0x80, 0xC0, 0x00,
+  0x00, 0x0B, 0x80, 0x3F, 0x00, 0x00, 0xC0, 0x10, 0x80, 0x98, 0x00, 0x00,
+  0x0B, 0x80, 0x67, 0x00, 0x00, 0xC0, 0x10, 0x80, 0x73, 0x00, 0x00, 0x0B,
+  0x80, 0x8C, 0x00, 0x00, 0xC0, 0x10, 0x80, 0x4C, 0x00, 0x00, 0x0B, 0x80,
+  0xB3, 0x00, 0x00, 0xC0, 0x10, 0x80, 0x24, 0x00, 0x00, 0x0B, 0x80, 0xDB,
+  0x00, 0x00, 0xC0, 0x10, 0x81, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0A,
+  0x81, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x11, 0x80, 0xD6, 0x00,
+  0x00, 0x0B, 0x80, 0x29, 0x00, 0x00, 0xC0, 0x11, 0x80, 0xAF, 0x00, 0x00,
+  0x0B, 0x80, 0x50, 0x00, 0x00, 0xC0, 0x11, 0x80, 0x89, 0x00, 0x00, 0x0B,
+  0x80, 0x76, 0x00, 0x00, 0xC0, 0x80, 0x00, 0x00, 0x44, 0x10, 0x80, 0x62,
+  0x00, 0x00, 0x0B, 0x80, 0x9D, 0x00, 0x00, 0xC0, 0x80, 0x00, 0x00, 0x89,
+  0x10, 0x80, 0x3A, 0x00, 0x00, 0x0B, 0x80, 0xC5, 0x00, 0x00, 0xC0, 0x80,
+  0x00, 0x00, 0xCA, 0x10, 0x80, 0x15, 0x00, 0x00, 0x0B, 0x80, 0xEA, 0x00,
+  0x00, 0xC0, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0E, 0x0F, 0x81, 0x00,
+  0x00, 0x00, 0xED, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x53, 0x10, 0x80, 0xC5, 0x00, 0x00,
+  0x0B, 0x80, 0x3A, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x94, 0x10,
+  0x80, 0xA0, 0x00, 0x00, 0x0B, 0x80, 0x5F, 0x00, 0x00, 0xC0, 0x00, 0x80,
+  0x00, 0x00, 0xD8, 0x10, 0x80, 0x78, 0x00, 0x00, 0x0B, 0x80, 0x87, 0x00,
+  0x00, 0xC0, 0x00, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1D, 0x0F, 0x80,
+  0x51, 0x00, 0x00, 0x0B, 0x80, 0xAE, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x00,
+  0x00, 0x5E, 0x0F, 0x80, 0x2C, 0x00, 0x00, 0x0B, 0x80, 0xD3, 0x00, 0x00,
+  0xC0, 0x01, 0x80, 0x00, 0x00, 0xA2, 0x0F, 0x80, 0x04, 0x00, 0x00, 0x0B,
+  0x80, 0xFB, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x00, 0x00, 0xE7, 0x0F, 0x81,
+  0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x24,
+  0x00, 0x00, 0xC0, 0x01, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x28, 0x0F,
+  0x80, 0xB6, 0x00, 0x00, 0x0B, 0x80, 0x49, 0x00, 0x00, 0xC0, 0x02, 0x80,
+  0x00, 0x00, 0x6C, 0x0F, 0x80, 0x8F, 0x00, 0x00, 0x0B, 0x80, 0x70, 0x00,
+  0x00, 0xC0, 0x02, 0x80, 0x00, 0x00, 0xB1, 0x0F, 0x80, 0x67, 0x00, 0x00,
+  0x0B, 0x80, 0x98, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x00, 0x00, 0xF2, 0x0F,
+  0x80, 0x42, 0x00, 0x00, 0x0B, 0x80, 0xBD, 0x00, 0x00, 0xC0, 0x02, 0x81,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x36, 0x0E, 0x80, 0x1A, 0x00, 0x00, 0x0B,
+  0x80, 0xE5, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x7B, 0x0E, 0x81,
+  0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x0D,
+  0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0xCD, 0x00,
+  0x00, 0x0B, 0x80, 0x32, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x00, 0xFF,
+  0x0F, 0x80, 0xA5, 0x00, 0x00, 0x0B, 0x80, 0x5A, 0x00, 0x00, 0xC0, 0x04,
+  0x80, 0x00, 0x00, 0x45, 0x0E, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0x80, 0x81,
+  0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0x00, 0x86, 0x0E, 0x80, 0x58, 0x00,
+  0x00, 0x0B, 0x80, 0xA7, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0x00, 0xCA,
+  0x0E, 0x80, 0x31, 0x00, 0x00, 0x0B, 0x80, 0xCE, 0x00, 0x00, 0xC0, 0x04,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x0D, 0x80, 0x09, 0x00, 0x00,
+  0x0B, 0x80, 0xF6, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x00, 0x00, 0x50, 0x0D,
+  0x81, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x00, 0x00, 0x94, 0x0E, 0x80, 0xBB,
+  0x00, 0x00, 0x0B, 0x80, 0x44, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x00, 0x00,
+  0xD9, 0x0E, 0x80, 0x94, 0x00, 0x00, 0x0B, 0x80, 0x6B, 0x00, 0x00, 0xC0,
+  0x80, 0x00, 0x00, 0xE5, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1A,
+  0x0D, 0x80, 0x6F, 0x00, 0x00, 0x0B, 0x80, 0x90, 0x00, 0x00, 0xC0, 0x80,
+  0x00, 0x00, 0xA1, 0x05, 0x80, 0x00, 0x00, 0x5E, 0x0D, 0x80, 0x47, 0x00,
+  0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0xC0, 0x80, 0x00, 0x00, 0x5C, 0x05,
+  0x80, 0x00, 0x00, 0xA3, 0x0D, 0x80, 0x20, 0x00, 0x00, 0x0B, 0x80, 0xDF,
+  0x00, 0x00, 0xC0, 0x80, 0x00, 0x00, 0x1B, 0x05, 0x80, 0x00, 0x00, 0xE4,
+  0x0D, 0x81, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0xC0, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7,
+  0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x28, 0x0D, 0x80, 0xD2, 0x00,
+  0x00, 0x0B, 0x80, 0x2D, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x92,
+  0x05, 0x80, 0x00, 0x00, 0x6D, 0x0D, 0x80, 0xAA, 0x00, 0x00, 0x0B, 0x80,
+  0x55, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x51, 0x05, 0x80, 0x00,
+  0x00, 0xAE, 0x0D, 0x80, 0x85, 0x00, 0x00, 0x0B, 0x80, 0x7A, 0x00, 0x00,
+  0xC0, 0x00, 0x80, 0x00, 0x00, 0x0D, 0x05, 0x80, 0x00, 0x00, 0xF2, 0x0D,
+  0x80, 0x5E, 0x00, 0x00, 0x0B, 0x80, 0xA1, 0x00, 0x00, 0xC0, 0x00, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x37, 0x0C, 0x80, 0x36, 0x00, 0x00, 0x0B, 0x80, 0xC9, 0x00, 0x00,
+  0xC0, 0x01, 0x80, 0x00, 0x00, 0x87, 0x05, 0x80, 0x00, 0x00, 0x78, 0x0C,
+  0x80, 0x11, 0x00, 0x00, 0x0B, 0x80, 0xEE, 0x00, 0x00, 0xC0, 0x01, 0x80,
+  0x00, 0x00, 0x43, 0x05, 0x80, 0x00, 0x00, 0xBC, 0x0C, 0x81, 0x00, 0x00,
+  0x00, 0xE8, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x17, 0x00, 0x00,
+  0xC0, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x04, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x01, 0x0C, 0x80, 0xC1, 0x00, 0x00, 0x0B, 0x80,
+  0x3E, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x00, 0x00, 0xBD, 0x05, 0x80, 0x00,
+  0x00, 0x42, 0x0C, 0x80, 0x9B, 0x00, 0x00, 0x0B, 0x80, 0x64, 0x00, 0x00,
+  0xC0, 0x02, 0x80, 0x00, 0x00, 0x79, 0x05, 0x80, 0x00, 0x00, 0x86, 0x0C,
+  0x80, 0x74, 0x00, 0x00, 0x0B, 0x80, 0x8B, 0x00, 0x00, 0xC0, 0x02, 0x80,
+  0x00, 0x00, 0x34, 0x05, 0x80, 0x00, 0x00, 0xCB, 0x0C, 0x80, 0x4C, 0x00,
+  0x00, 0x0B, 0x80, 0xB3, 0x00, 0x00, 0xC0, 0x02, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF3, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0C, 0x0B,
+  0x80, 0x27, 0x00, 0x00, 0x0B, 0x80, 0xD8, 0x00, 0x00, 0xC0, 0x03, 0x80,
+  0x00, 0x00, 0xAF, 0x05, 0x80, 0x00, 0x00, 0x50, 0x0B, 0x80, 0x00, 0x00,
+  0x00, 0x0B, 0x80, 0xFF, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x6A,
+  0x05, 0x80, 0x00, 0x00, 0x95, 0x0C, 0x80, 0xD7, 0x00, 0x00, 0x0B, 0x80,
+  0x28, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x29, 0x05, 0x80, 0x00,
+  0x00, 0xD6, 0x0C, 0x80, 0xB2, 0x00, 0x00, 0x0B, 0x80, 0x4D, 0x00, 0x00,
+  0xC0, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x04, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x1A, 0x0B, 0x80, 0x8A, 0x00, 0x00, 0x0B, 0x80,
+  0x75, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0x00, 0xA0, 0x05, 0x80, 0x00,
+  0x00, 0x5F, 0x0B, 0x80, 0x63, 0x00, 0x00, 0x0B, 0x80, 0x9C, 0x00, 0x00,
+  0xC0, 0x04, 0x80, 0x00, 0x00, 0x5F, 0x05, 0x80, 0x00, 0x00, 0xA0, 0x0B,
+  0x80, 0x3E, 0x00, 0x00, 0x0B, 0x80, 0xC1, 0x00, 0x00, 0xC0, 0x04, 0x80,
+  0x00, 0x00, 0x1B, 0x05, 0x80, 0x00, 0x00, 0xE4, 0x0B, 0x80, 0x16, 0x00,
+  0x00, 0x0B, 0x80, 0xE9, 0x00, 0x00, 0xC0, 0x04, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xD6, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x29, 0x0A,
+  0x81, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x00, 0x00, 0x95, 0x05, 0x80, 0x00,
+  0x00, 0x6A, 0x0B, 0x80, 0xC8, 0x00, 0x00, 0x0B, 0x80, 0x37, 0x00, 0x00,
+  0xC0, 0x05, 0x80, 0x00, 0x00, 0x51, 0x05, 0x80, 0x00, 0x00, 0xAE, 0x0B,
+  0x80, 0xA1, 0x00, 0x00, 0x0B, 0x80, 0x5E, 0x00, 0x00, 0xC0, 0x05, 0x80,
+  0x00, 0x00, 0x0C, 0x05, 0x80, 0x00, 0x00, 0xF3, 0x0B, 0x80, 0x79, 0x00,
+  0x00, 0x0B, 0x80, 0x86, 0x00, 0x00, 0xC0, 0x05, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xCB, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x34, 0x0A,
+  0x80, 0x54, 0x00, 0x00, 0x0B, 0x80, 0xAB, 0x00, 0x00, 0xC0, 0x06, 0x80,
+  0x00, 0x00, 0x87, 0x05, 0x80, 0x00, 0x00, 0x78, 0x0A, 0x80, 0x2C, 0x00,
+  0x00, 0x0B, 0x80, 0xD3, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x00, 0x00, 0x42,
+  0x05, 0x80, 0x00, 0x00, 0xBD, 0x0A, 0x80, 0x05, 0x00, 0x00, 0x0B, 0x80,
+  0xFA, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x00, 0x00, 0x01, 0x05, 0x80, 0x00,
+  0x00, 0xFE, 0x0A, 0x81, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x0A, 0x81,
+  0xFF, 0x00, 0x00, 0x20, 0x00, 0x00, 0xC0, 0x06, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBD, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x42, 0x0A,
+  0x80, 0xB7, 0x00, 0x00, 0x0B, 0x80, 0x48, 0x00, 0x00, 0xC0, 0x07, 0x80,
+  0x00, 0x00, 0x78, 0x05, 0x80, 0x00, 0x00, 0x87, 0x0A, 0x80, 0x90, 0x00,
+  0x00, 0x0B, 0x80, 0x6F, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x37,
+  0x05, 0x80, 0x00, 0x00, 0xC8, 0x0A, 0x80, 0x6A, 0x00, 0x00, 0x0B, 0x80,
+  0x95, 0x00, 0x00, 0xC0, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
+  0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0D, 0x09, 0x80, 0x43, 0x00,
+  0x00, 0x0B, 0x80, 0xBC, 0x00, 0x00, 0xC0, 0x08, 0x80, 0x00, 0x00, 0xAE,
+  0x05, 0x80, 0x00, 0x00, 0x51, 0x09, 0x80, 0x1B, 0x00, 0x00, 0x0B, 0x80,
+  0xE4, 0x00, 0x00, 0xC0, 0x08, 0x80, 0x00, 0x00, 0x6D, 0x05, 0x80, 0x00,
+  0x00, 0x92, 0x09, 0x81, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x0A, 0x81,
+  0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xC0, 0x08, 0x80, 0x00, 0x00, 0x28,
+  0x05, 0x80, 0x00, 0x00, 0xD7, 0x0A, 0x80, 0xCD, 0x00, 0x00, 0x0B, 0x80,
+  0x32, 0x00, 0x00, 0xC0, 0x08, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4,
+  0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1B, 0x09, 0x80, 0xA6, 0x00,
+  0x00, 0x0B, 0x80, 0x59, 0x00, 0x00, 0xC0, 0x09, 0x80, 0x00, 0x00, 0xA3,
+  0x05, 0x80, 0x00, 0x00, 0x5C, 0x09, 0x80, 0x81, 0x00, 0x00, 0x0B, 0x80,
+  0x7E, 0x00, 0x00, 0xC0, 0x09, 0x80, 0x00, 0x00, 0x5E, 0x05, 0x80, 0x00,
+  0x00, 0xA1, 0x09, 0x80, 0x59, 0x00, 0x00, 0x0B, 0x80, 0xA6, 0x00, 0x00,
+  0xC0, 0x09, 0x80, 0x00, 0x00, 0x1A, 0x05, 0x80, 0x00, 0x00, 0xE5, 0x09,
+  0x80, 0x32, 0x00, 0x00, 0x0B, 0x80, 0xCD, 0x00, 0x00, 0xC0, 0x09, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x26, 0x08, 0x80, 0x0C, 0x00, 0x00, 0x0B, 0x80, 0xF3, 0x00, 0x00,
+  0xC0, 0x0A, 0x80, 0x00, 0x00, 0x94, 0x05, 0x80, 0x00, 0x00, 0x6B, 0x08,
+  0x81, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00,
+  0x1B, 0x00, 0x00, 0xC0, 0x0A, 0x80, 0x00, 0x00, 0x50, 0x05, 0x80, 0x00,
+  0x00, 0xAF, 0x09, 0x80, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x43, 0x00, 0x00,
+  0xC0, 0x0A, 0x80, 0x00, 0x00, 0x0F, 0x05, 0x80, 0x00, 0x00, 0xF0, 0x09,
+  0x80, 0x97, 0x00, 0x00, 0x0B, 0x80, 0x68, 0x00, 0x00, 0xC0, 0x0A, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x35, 0x08, 0x80, 0x70, 0x00, 0x00, 0x0B, 0x80, 0x8F, 0x00, 0x00,
+  0xC0, 0x0B, 0x80, 0x00, 0x00, 0x86, 0x05, 0x80, 0x00, 0x00, 0x79, 0x08,
+  0x80, 0x48, 0x00, 0x00, 0x0B, 0x80, 0xB7, 0x00, 0x00, 0xC0, 0x0B, 0x80,
+  0x00, 0x00, 0x45, 0x05, 0x80, 0x00, 0x00, 0xBA, 0x08, 0x80, 0x23, 0x00,
+  0x00, 0x0B, 0x80, 0xDC, 0x00, 0x00, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00,
+  0x05, 0x80, 0x00, 0x00, 0xFF, 0x08, 0x81, 0x00, 0x00, 0x00, 0xFA, 0x00,
+  0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0xC0, 0x0C, 0x80,
+  0x00, 0x00, 0xBC, 0x05, 0x80, 0x00, 0x00, 0x43, 0x08, 0x80, 0xD3, 0x00,
+  0x00, 0x0B, 0x80, 0x2C, 0x00, 0x00, 0xC0, 0x0C, 0x80, 0x00, 0x00, 0x7B,
+  0x05, 0x80, 0x00, 0x00, 0x84, 0x08, 0x80, 0xAD, 0x00, 0x00, 0x0B, 0x80,
+  0x52, 0x00, 0x00, 0xC0, 0x0C, 0x80, 0x00, 0x00, 0x36, 0x05, 0x80, 0x00,
+  0x00, 0xC9, 0x08, 0x80, 0x86, 0x00, 0x00, 0x0B, 0x80, 0x79, 0x00, 0x00,
+  0xC0, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x04, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x0D, 0x07, 0x80, 0x5E, 0x00, 0x00, 0x0B, 0x80,
+  0xA1, 0x00, 0x00, 0xC0, 0x0D, 0x80, 0x00, 0x00, 0xB1, 0x05, 0x80, 0x00,
+  0x00, 0x4E, 0x07, 0x80, 0x39, 0x00, 0x00, 0x0B, 0x80, 0xC6, 0x00, 0x00,
+  0xC0, 0x0D, 0x80, 0x00, 0x00, 0x6C, 0x05, 0x80, 0x00, 0x00, 0x93, 0x07,
+  0x80, 0x12, 0x00, 0x00, 0x0B, 0x80, 0xED, 0x00, 0x00, 0xC0, 0x0D, 0x80,
+  0x00, 0x00, 0x28, 0x05, 0x80, 0x00, 0x00, 0xD7, 0x07, 0x81, 0x00, 0x00,
+  0x00, 0xE9, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x16, 0x00, 0x00,
+  0xC0, 0x0D, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x04, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x18, 0x07, 0x80, 0xC4, 0x00, 0x00, 0x0B, 0x80,
+  0x3B, 0x00, 0x00, 0xC0, 0x0E, 0x80, 0x00, 0x00, 0xA2, 0x05, 0x80, 0x00,
+  0x00, 0x5D, 0x07, 0x80, 0x9C, 0x00, 0x00, 0x0B, 0x80, 0x63, 0x00, 0x00,
+  0xC0, 0x0E, 0x80, 0x00, 0x00, 0x5E, 0x05, 0x80, 0x00, 0x00, 0xA1, 0x07,
+  0x80, 0x75, 0x00, 0x00, 0x0B, 0x80, 0x8A, 0x00, 0x00, 0xC0, 0x0E, 0x80,
+  0x00, 0x00, 0x1D, 0x05, 0x80, 0x00, 0x00, 0xE2, 0x07, 0x80, 0x50, 0x00,
+  0x00, 0x0B, 0x80, 0xAF, 0x00, 0x00, 0xC0, 0x0E, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xD8, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x27, 0x06,
+  0x80, 0x28, 0x00, 0x00, 0x0B, 0x80, 0xD7, 0x00, 0x00, 0xC0, 0x0F, 0x80,
+  0x00, 0x00, 0x94, 0x05, 0x80, 0x00, 0x00, 0x6B, 0x06, 0x80, 0x00, 0x00,
+  0x00, 0x0B, 0x80, 0xFF, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x53,
+  0x05, 0x80, 0x00, 0x00, 0xAC, 0x07, 0x80, 0xDA, 0x00, 0x00, 0x0B, 0x80,
+  0x25, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x0E, 0x05, 0x80, 0x00,
+  0x00, 0xF1, 0x07, 0x80, 0xB3, 0x00, 0x00, 0x0B, 0x80, 0x4C, 0x00, 0x00,
+  0xC0, 0x0F, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0x04, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x35, 0x06, 0x80, 0x8B, 0x00, 0x00, 0x0B, 0x80,
+  0x74, 0x00, 0x00, 0xC0, 0x10, 0x80, 0x00, 0x00, 0x89, 0x05, 0x80, 0x00,
+  0x00, 0x76, 0x06, 0x80, 0x66, 0x00, 0x00, 0x0B, 0x80, 0x99, 0x00, 0x00,
+  0xC0, 0x10, 0x80, 0x00, 0x00, 0x44, 0x05, 0x80, 0x00, 0x00, 0xBB, 0x06,
+  0x80, 0x3E, 0x00, 0x00, 0x0B, 0x80, 0xC1, 0x00, 0x00, 0xC0, 0x10, 0x80,
+  0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0xFF, 0x06, 0x80, 0x17, 0x00,
+  0x00, 0x0B, 0x80, 0xE8, 0x00, 0x00, 0xC0, 0x11, 0x80, 0x00, 0x00, 0xBF,
+  0x05, 0x80, 0x00, 0x00, 0x40, 0x05, 0x81, 0x00, 0x00, 0x00, 0xF1, 0x00,
+  0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xC0, 0x11, 0x80,
+  0x00, 0x00, 0x7A, 0x05, 0x80, 0x00, 0x00, 0x85, 0x06, 0x80, 0xC9, 0x00,
+  0x00, 0x0B, 0x80, 0x36, 0x00, 0x00, 0xC0, 0x11, 0x80, 0x00, 0x00, 0x36,
+  0x05, 0x80, 0x00, 0x00, 0xC9, 0x06, 0x80, 0xA1, 0x00, 0x00, 0x0B, 0x80,
+  0x5E, 0x00, 0x00, 0xC0, 0x11, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
+  0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x05, 0x80, 0x7C, 0x00,
+  0x00, 0x0B, 0x80, 0x83, 0x00, 0x00, 0xC0, 0x12, 0x80, 0x00, 0x00, 0xB0,
+  0x05, 0x80, 0x00, 0x00, 0x4F, 0x05, 0x80, 0x55, 0x00, 0x00, 0x0B, 0x80,
+  0xAA, 0x00, 0x00, 0xC0, 0x12, 0x80, 0x00, 0x00, 0x6C, 0x05, 0x80, 0x00,
+  0x00, 0x93, 0x05, 0x80, 0x2D, 0x00, 0x00, 0x0B, 0x80, 0xD2, 0x00, 0x00,
+  0xC0, 0x12, 0x80, 0x00, 0x00, 0x2B, 0x05, 0x80, 0x00, 0x00, 0xD4, 0x05,
+  0x80, 0x08, 0x00, 0x00, 0x0B, 0x80, 0xF7, 0x00, 0x00, 0xC0, 0x12, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x19, 0x04, 0x81, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x0A, 0x81,
+  0xFF, 0x00, 0x00, 0x20, 0x00, 0x00, 0xC0, 0x13, 0x80, 0x00, 0x00, 0xA2,
+  0x05, 0x80, 0x00, 0x00, 0x5D, 0x05, 0x80, 0xB8, 0x00, 0x00, 0x0B, 0x80,
+  0x47, 0x00, 0x00, 0xC0, 0x13, 0x80, 0x00, 0x00, 0x61, 0x05, 0x80, 0x00,
+  0x00, 0x9E, 0x05, 0x80, 0x93, 0x00, 0x00, 0x0B, 0x80, 0x6C, 0x00, 0x00,
+  0xC0, 0x13, 0x80, 0x00, 0x00, 0x1C, 0x05, 0x80, 0x00, 0x00, 0xE3, 0x05,
+  0x80, 0x6B, 0x00, 0x00, 0x0B, 0x80, 0x94, 0x00, 0x00, 0xC0, 0x13, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x27, 0x04, 0x80, 0x44, 0x00, 0x00, 0x0B, 0x80, 0xBB, 0x00, 0x00,
+  0xC0, 0x14, 0x80, 0x00, 0x00, 0x97, 0x05, 0x80, 0x00, 0x00, 0x68, 0x04,
+  0x80, 0x1E, 0x00, 0x00, 0x0B, 0x80, 0xE1, 0x00, 0x00, 0xC0, 0x14, 0x80,
+  0x00, 0x00, 0x52, 0x05, 0x80, 0x00, 0x00, 0xAD, 0x04, 0x81, 0x00, 0x00,
+  0x00, 0xF6, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0xC0, 0x14, 0x80, 0x00, 0x00, 0x0E, 0x05, 0x80, 0x00, 0x00, 0xF1, 0x05,
+  0x80, 0xCE, 0x00, 0x00, 0x0B, 0x80, 0x31, 0x00, 0x00, 0xC0, 0x14, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x32, 0x04, 0x80, 0xA9, 0x00, 0x00, 0x0B, 0x80, 0x56, 0x00, 0x00,
+  0xC0, 0x15, 0x80, 0x00, 0x00, 0x88, 0x05, 0x80, 0x00, 0x00, 0x77, 0x04,
+  0x80, 0x81, 0x00, 0x00, 0x0B, 0x80, 0x7E, 0x00, 0x00, 0xC0, 0x15, 0x80,
+  0x00, 0x00, 0x44, 0x05, 0x80, 0x00, 0x00, 0xBB, 0x04, 0x80, 0x5A, 0x00,
+  0x00, 0x0B, 0x80, 0xA5, 0x00, 0x00, 0xC0, 0x15, 0x80, 0x00, 0x00, 0x03,
+  0x05, 0x80, 0x00, 0x00, 0xFC, 0x04, 0x80, 0x35, 0x00, 0x00, 0x0B, 0x80,
+  0xCA, 0x00, 0x00, 0xC0, 0x15, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
+  0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x41, 0x03, 0x80, 0x0D, 0x00,
+  0x00, 0x0B, 0x80, 0xF2, 0x00, 0x00, 0xC0, 0x16, 0x80, 0x00, 0x00, 0x7A,
+  0x05, 0x80, 0x00, 0x00, 0x85, 0x03, 0x81, 0x00, 0x00, 0x00, 0xE5, 0x00,
+  0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x1A, 0x00, 0x00, 0xC0, 0x16, 0x80,
+  0x00, 0x00, 0x39, 0x05, 0x80, 0x00, 0x00, 0xC6, 0x04, 0x80, 0xBF, 0x00,
+  0x00, 0x0B, 0x80, 0x40, 0x00, 0x00, 0xC0, 0x16, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF4, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0x03,
+  0x80, 0x98, 0x00, 0x00, 0x0B, 0x80, 0x67, 0x00, 0x00, 0xC0, 0x80, 0x00,
+  0x00, 0x53, 0x16, 0x80, 0x00, 0x00, 0xAF, 0x05, 0x80, 0x00, 0x00, 0x50,
+  0x03, 0x80, 0x70, 0x00, 0x00, 0x0B, 0x80, 0x8F, 0x00, 0x00, 0xC0, 0x80,
+  0x00, 0x00, 0xA2, 0x16, 0x80, 0x00, 0x00, 0x6F, 0x05, 0x80, 0x00, 0x00,
+  0x90, 0x03, 0x80, 0x4B, 0x00, 0x00, 0x0B, 0x80, 0xB4, 0x00, 0x00, 0xC0,
+  0x80, 0x00, 0x00, 0xF5, 0x16, 0x80, 0x00, 0x00, 0x2A, 0x05, 0x80, 0x00,
+  0x00, 0xD5, 0x03, 0x80, 0x24, 0x00, 0x00, 0x0B, 0x80, 0xDB, 0x00, 0x00,
+  0xC0, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x49, 0x15, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xE5, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1A,
+  0x02, 0x81, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x98, 0x16, 0x80,
+  0x00, 0x00, 0xA5, 0x05, 0x80, 0x00, 0x00, 0x5A, 0x03, 0x80, 0xD6, 0x00,
+  0x00, 0x0B, 0x80, 0x29, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0xEB,
+  0x16, 0x80, 0x00, 0x00, 0x60, 0x05, 0x80, 0x00, 0x00, 0x9F, 0x03, 0x80,
+  0xAE, 0x00, 0x00, 0x0B, 0x80, 0x51, 0x00, 0x00, 0xC0, 0x00, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x3F, 0x15, 0x80, 0x00, 0x00, 0x1B, 0x05, 0x80,
+  0x00, 0x00, 0xE4, 0x03, 0x80, 0x87, 0x00, 0x00, 0x0B, 0x80, 0x78, 0x00,
+  0x00, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x8D, 0x15, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xDB, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x24, 0x02,
+  0x80, 0x61, 0x00, 0x00, 0x0B, 0x80, 0x9E, 0x00, 0x00, 0xC0, 0x01, 0x80,
+  0x00, 0x00, 0xE1, 0x16, 0x80, 0x00, 0x00, 0x96, 0x05, 0x80, 0x00, 0x00,
+  0x69, 0x02, 0x80, 0x3A, 0x00, 0x00, 0x0B, 0x80, 0xC5, 0x00, 0x00, 0xC0,
+  0x01, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x34, 0x15, 0x80, 0x00, 0x00,
+  0x51, 0x05, 0x80, 0x00, 0x00, 0xAE, 0x02, 0x80, 0x12, 0x00, 0x00, 0x0B,
+  0x80, 0xED, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x00, 0x00, 0x83, 0x15, 0x80,
+  0x00, 0x00, 0x11, 0x05, 0x80, 0x00, 0x00, 0xEE, 0x02, 0x81, 0x00, 0x00,
+  0x00, 0xEC, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x13, 0x00, 0x00,
+  0xC0, 0x02, 0x80, 0x00, 0x00, 0xD7, 0x15, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xCC, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x33, 0x02, 0x80,
+  0xC5, 0x00, 0x00, 0x0B, 0x80, 0x3A, 0x00, 0x00, 0xC0, 0x02, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x2A, 0x15, 0x80, 0x00, 0x00, 0x87, 0x05, 0x80,
+  0x00, 0x00, 0x78, 0x02, 0x80, 0x9D, 0x00, 0x00, 0x0B, 0x80, 0x62, 0x00,
+  0x00, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x79, 0x15, 0x80, 0x00, 0x00, 0x47,
+  0x05, 0x80, 0x00, 0x00, 0xB8, 0x02, 0x80, 0x78, 0x00, 0x00, 0x0B, 0x80,
+  0x87, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x00, 0xCC, 0x15, 0x80, 0x00,
+  0x00, 0x02, 0x05, 0x80, 0x00, 0x00, 0xFD, 0x02, 0x80, 0x50, 0x00, 0x00,
+  0x0B, 0x80, 0xAF, 0x00, 0x00, 0xC0, 0x03, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x20, 0x14, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x04, 0x81,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x42, 0x01, 0x80, 0x29, 0x00, 0x00, 0x0B,
+  0x80, 0xD6, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0x00, 0x6F, 0x15, 0x80,
+  0x00, 0x00, 0x7D, 0x05, 0x80, 0x00, 0x00, 0x82, 0x01, 0x80, 0x04, 0x00,
+  0x00, 0x0B, 0x80, 0xFB, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0x00, 0xC2,
+  0x15, 0x80, 0x00, 0x00, 0x38, 0x05, 0x80, 0x00, 0x00, 0xC7, 0x01, 0x81,
+  0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x24,
+  0x00, 0x00, 0xC0, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x16, 0x14,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x04, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x0C, 0x01, 0x80, 0xB3, 0x00, 0x00, 0x0B, 0x80, 0x4C, 0x00,
+  0x00, 0xC0, 0x05, 0x80, 0x00, 0x00, 0x64, 0x15, 0x80, 0x00, 0x00, 0xB3,
+  0x05, 0x80, 0x00, 0x00, 0x4C, 0x01, 0x80, 0x8E, 0x00, 0x00, 0x0B, 0x80,
+  0x71, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x00, 0x00, 0xB8, 0x15, 0x80, 0x00,
+  0x00, 0x6E, 0x05, 0x80, 0x00, 0x00, 0x91, 0x01, 0x80, 0x67, 0x00, 0x00,
+  0x0B, 0x80, 0x98, 0x00, 0x00, 0xC0, 0x05, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x0C, 0x14, 0x80, 0x00, 0x00, 0x29, 0x05, 0x80, 0x00, 0x00, 0xD6,
+  0x01, 0x80, 0x3F, 0x00, 0x00, 0x0B, 0x80, 0xC0, 0x00, 0x00, 0xC0, 0x06,
+  0x80, 0x00, 0x00, 0x5A, 0x14, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9,
+  0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x16, 0x00, 0x80, 0x1A, 0x00,
+  0x00, 0x0B, 0x80, 0xE5, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x00, 0x00, 0xAE,
+  0x15, 0x80, 0x00, 0x00, 0xA4, 0x05, 0x80, 0x00, 0x00, 0x5B, 0x00, 0x81,
+  0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0xC0, 0x06, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x14,
+  0x80, 0x00, 0x00, 0x5F, 0x05, 0x80, 0x00, 0x00, 0xA0, 0x01, 0x80, 0xCA,
+  0x00, 0x00, 0x0B, 0x80, 0x35, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x00, 0x00,
+  0x50, 0x14, 0x80, 0x00, 0x00, 0x1F, 0x05, 0x80, 0x00, 0x00, 0xE0, 0x01,
+  0x80, 0xA5, 0x00, 0x00, 0x0B, 0x80, 0x5A, 0x00, 0x00, 0xC0, 0x07, 0x80,
+  0x00, 0x00, 0xA4, 0x14, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x04,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x25, 0x00, 0x80, 0x7D, 0x00, 0x00,
+  0x0B, 0x80, 0x82, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x00, 0x00, 0xF7, 0x15,
+  0x80, 0x00, 0x00, 0x95, 0x05, 0x80, 0x00, 0x00, 0x6A, 0x00, 0x80, 0x56,
+  0x00, 0x00, 0x0B, 0x80, 0xA9, 0x00, 0x00, 0xC0, 0x07, 0x81, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x46, 0x14, 0x80, 0x00, 0x00, 0x55, 0x05, 0x80, 0x00,
+  0x00, 0xAA, 0x00, 0x80, 0x30, 0x00, 0x00, 0x0B, 0x80, 0xCF, 0x00, 0x00,
+  0xC0, 0x08, 0x80, 0x00, 0x00, 0x99, 0x14, 0x80, 0x00, 0x00, 0x10, 0x05,
+  0x80, 0x00, 0x00, 0xEF, 0x00, 0x80, 0x09, 0x00, 0x00, 0x0B, 0x80, 0xF6,
+  0x00, 0x00, 0xC0, 0x08, 0x80, 0x00, 0x00, 0xED, 0x14, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xCB, 0x04, 0x83, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x34,
+  0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0xC0, 0x08, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x14,
+  0x80, 0x00, 0x00, 0x8B, 0x05, 0x80, 0x00, 0x00, 0x74, 0x00, 0x80, 0xBB,
+  0x00, 0x00, 0x0B, 0x80, 0x44, 0x00, 0x00, 0xC0, 0x09, 0x80, 0x00, 0x00,
+  0x8F, 0x14, 0x80, 0x00, 0x00, 0x46, 0x05, 0x80, 0x00, 0x00, 0xB9, 0x00,
+  0x80, 0x93, 0x00, 0x00, 0x0B, 0x80, 0x6C, 0x00, 0x00, 0xC0, 0x09, 0x80,
+  0x00, 0x00, 0xE3, 0x14, 0x80, 0x00, 0x00, 0x01, 0x05, 0x80, 0x00, 0x00,
+  0xFE, 0x00, 0x80, 0x6C, 0x00, 0x00, 0x0B, 0x80, 0x93, 0x00, 0x00, 0xC0,
+  0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x31, 0x13, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xC1, 0x04, 0x82, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3E,
+  0x47, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0xC0, 0x0A, 0x80, 0x00,
+  0x00, 0x85, 0x14, 0x80, 0x00, 0x00, 0x7C, 0x05, 0x81, 0x00, 0x00, 0x83,
+  0x1F, 0x00, 0x00, 0x0B, 0x80, 0xE0, 0x00, 0x00, 0xC0, 0x0A, 0x80, 0x00,
+  0x00, 0xD9, 0x14, 0x80, 0x00, 0x00, 0x37, 0x05, 0x82, 0x00, 0x00, 0xC8,
+  0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0xC0, 0x80, 0x00, 0x00, 0xD8, 0x09, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x27, 0x13, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x04,
+  0x82, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x08, 0xD1, 0x00, 0x00, 0x0B, 0x80,
+  0x2E, 0x00, 0x00, 0xC0, 0x80, 0x00, 0x00, 0x84, 0x0A, 0x80, 0x00, 0x00,
+  0x7B, 0x14, 0x80, 0x00, 0x00, 0xB2, 0x05, 0x81, 0x00, 0x00, 0x4D, 0xAA,
+  0x00, 0x00, 0x0B, 0x80, 0x55, 0x00, 0x00, 0xC0, 0x80, 0x00, 0x00, 0x31,
+  0x0A, 0x80, 0x00, 0x00, 0xCE, 0x14, 0x80, 0x00, 0x00, 0x6D, 0x05, 0x81,
+  0x00, 0x00, 0x92, 0x82, 0x00, 0x00, 0x0B, 0x80, 0x7D, 0x00, 0x00, 0xC0,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x09, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x1D, 0x13, 0x80, 0x00, 0x00, 0x2D, 0x05, 0x81, 0x00, 0x00,
+  0xD2, 0x5D, 0x00, 0x00, 0x0B, 0x80, 0xA2, 0x00, 0x00, 0xC0, 0x00, 0x80,
+  0x00, 0x00, 0x8E, 0x0A, 0x80, 0x00, 0x00, 0x71, 0x13, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xE8, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x36, 0x00, 0x17,
+  0x0B, 0x80, 0xC9, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x3B, 0x0A,
+  0x80, 0x00, 0x00, 0xC4, 0x14, 0x80, 0x00, 0x00, 0xA3, 0x05, 0x80, 0x0E,
+  0x00, 0x5C, 0x0B, 0x80, 0xF1, 0x00, 0x00, 0xC0, 0x00, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xEC, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x13,
+  0x13, 0x80, 0x00, 0x00, 0x63, 0x05, 0x81, 0x00, 0x00, 0x9C, 0xE8, 0x00,
+  0x00, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x17, 0x00, 0x00, 0xC0, 0x01, 0x80,
+  0x00, 0x00, 0x99, 0x0A, 0x80, 0x00, 0x00, 0x66, 0x13, 0x80, 0x00, 0x00,
+  0x1E, 0x05, 0x81, 0x00, 0x00, 0xE1, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x3F,
+  0x00, 0x00, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x45, 0x0A, 0x80, 0x00, 0x00,
+  0xBA, 0x13, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x04, 0x81, 0x00,
+  0x00, 0xFF, 0x99, 0x00, 0x26, 0x0B, 0x80, 0x66, 0x00, 0x00, 0xC0, 0x01,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x09, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x09, 0x13, 0x80, 0x00, 0x00, 0x99, 0x05, 0x80, 0x73, 0x00,
+  0x66, 0x0B, 0x80, 0x8C, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x00, 0x00, 0xA3,
+  0x0A, 0x80, 0x00, 0x00, 0x5C, 0x13, 0x80, 0x00, 0x00, 0x54, 0x05, 0x80,
+  0x4C, 0x00, 0xAB, 0x0B, 0x80, 0xB3, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x00,
+  0x00, 0x4F, 0x0A, 0x80, 0x00, 0x00, 0xB0, 0x13, 0x80, 0x00, 0x00, 0x0F,
+  0x05, 0x80, 0x24, 0x00, 0xF0, 0x0B, 0x80, 0xDB, 0x00, 0x00, 0xC0, 0x02,
+  0x80, 0x00, 0x00, 0x01, 0x0A, 0x80, 0x00, 0x00, 0xFE, 0x13, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xCF, 0x04, 0x81, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+  0x30, 0x0A, 0x81, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x02, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x52, 0x13, 0x80, 0x00, 0x00, 0x8A, 0x05, 0x80, 0xD7, 0x00, 0x75,
+  0x0B, 0x80, 0x28, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x59, 0x0A,
+  0x80, 0x00, 0x00, 0xA6, 0x13, 0x80, 0x00, 0x00, 0x45, 0x05, 0x80, 0xAF,
+  0x00, 0xBA, 0x0B, 0x80, 0x50, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x00,
+  0x0B, 0x0A, 0x80, 0x00, 0x00, 0xF4, 0x13, 0x80, 0x00, 0x00, 0x05, 0x05,
+  0x80, 0x8A, 0x00, 0xFA, 0x0B, 0x80, 0x75, 0x00, 0x00, 0xC0, 0x03, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x48, 0x12, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x04, 0x81,
+  0x62, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0x0A, 0x80, 0x9D, 0x00, 0x00, 0xC0,
+  0x04, 0x80, 0x00, 0x00, 0x64, 0x0A, 0x80, 0x00, 0x00, 0x9B, 0x13, 0x80,
+  0x00, 0x00, 0x7B, 0x04, 0x81, 0x3B, 0x00, 0xFF, 0xFF, 0x00, 0x84, 0x0A,
+  0x80, 0xC4, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0x00, 0x15, 0x0A, 0x80,
+  0x00, 0x00, 0xEA, 0x13, 0x80, 0x00, 0x00, 0x3B, 0x04, 0x81, 0x16, 0x00,
+  0xFF, 0xFF, 0x00, 0xC4, 0x0A, 0x80, 0xE9, 0x00, 0x00, 0xC0, 0x04, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x3E, 0x12, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x03, 0x82,
+  0x00, 0x00, 0xFF, 0xED, 0x00, 0xFF, 0xFF, 0x00, 0x09, 0x09, 0x81, 0xFF,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x00, 0x00, 0x6E, 0x0A,
+  0x80, 0x00, 0x00, 0x91, 0x13, 0x80, 0x00, 0x00, 0xB1, 0x04, 0x81, 0xC5,
+  0x00, 0xFF, 0xFF, 0x00, 0x4E, 0x0A, 0x80, 0x3A, 0x00, 0x00, 0xC0, 0x05,
+  0x80, 0x00, 0x00, 0x1F, 0x0A, 0x80, 0x00, 0x00, 0xE0, 0x13, 0x80, 0x00,
+  0x00, 0x71, 0x04, 0x81, 0xA0, 0x00, 0xFF, 0xFF, 0x00, 0x8E, 0x0A, 0x80,
+  0x5F, 0x00, 0x00, 0xC0, 0x05, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC,
+  0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x33, 0x12, 0x80, 0x00, 0x00,
+  0x2C, 0x04, 0x81, 0x79, 0x00, 0xFF, 0xFF, 0x00, 0xD3, 0x0A, 0x80, 0x86,
+  0x00, 0x00, 0xC0, 0x06, 0x80, 0x00, 0x00, 0x78, 0x0A, 0x80, 0x00, 0x00,
+  0x87, 0x12, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x03, 0x82, 0x51,
+  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x18, 0x09, 0x80, 0xAE, 0x00,
+  0x00, 0xC0, 0x06, 0x80, 0x00, 0x00, 0x29, 0x0A, 0x80, 0x00, 0x00, 0xD6,
+  0x13, 0x80, 0x00, 0x00, 0xA7, 0x03, 0x80, 0x2C, 0x00, 0xFF, 0x00, 0x80,
+  0xFF, 0x00, 0x58, 0x09, 0x80, 0xD3, 0x00, 0x00, 0xC0, 0x06, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xD6, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x29, 0x12, 0x80, 0x00, 0x00, 0x62, 0x03, 0x80, 0x04, 0x00, 0xFF, 0x00,
+  0x80, 0xFF, 0x00, 0x9D, 0x09, 0x80, 0xFB, 0x00, 0x00, 0xC0, 0x07, 0x80,
+  0x00, 0x00, 0x82, 0x0A, 0x80, 0x00, 0x00, 0x7D, 0x12, 0x80, 0x00, 0x00,
+  0x1D, 0x03, 0x82, 0x00, 0x00, 0xFF, 0xDC, 0x00, 0xFF, 0xFF, 0x00, 0xE2,
+  0x09, 0x81, 0xFF, 0x00, 0x00, 0x23, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x00,
+  0x00, 0x34, 0x0A, 0x80, 0x00, 0x00, 0xCB, 0x12, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xDD, 0x03, 0x82, 0xB7, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0x22, 0x09, 0x80, 0x48, 0x00, 0x00, 0xC0, 0x07, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xE0, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F,
+  0x12, 0x80, 0x00, 0x00, 0x98, 0x03, 0x80, 0x8F, 0x00, 0xFF, 0x00, 0x80,
+  0xFF, 0x00, 0x67, 0x09, 0x80, 0x70, 0x00, 0x00, 0xC0, 0x08, 0x80, 0x00,
+  0x00, 0x8C, 0x0A, 0x80, 0x00, 0x00, 0x73, 0x12, 0x80, 0x00, 0x00, 0x53,
+  0x03, 0x80, 0x68, 0x00, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0xAC, 0x09, 0x80,
+  0x97, 0x00, 0x00, 0xC0, 0x08, 0x80, 0x00, 0x00, 0x3E, 0x0A, 0x80, 0x00,
+  0x00, 0xC1, 0x12, 0x80, 0x00, 0x00, 0x13, 0x03, 0x80, 0x42, 0x00, 0xFF,
+  0x00, 0x80, 0xFF, 0x00, 0xEC, 0x09, 0x80, 0xBD, 0x00, 0x00, 0xC0, 0x80,
+  0x00, 0x19, 0x00, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x09,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x15, 0x11, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xCE, 0x02, 0x80, 0x1B, 0x00, 0xFF, 0x00, 0x81, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0x31, 0x08, 0x80, 0xE4, 0x00, 0x00, 0xC0, 0x80, 0x00,
+  0x32, 0x00, 0x08, 0x80, 0x00, 0x00, 0x97, 0x0A, 0x80, 0x00, 0x00, 0x68,
+  0x12, 0x80, 0x00, 0x00, 0x89, 0x02, 0x81, 0x00, 0x00, 0xFF, 0xF2, 0x00,
+  0xFF, 0x00, 0x80, 0xFF, 0x00, 0x76, 0x08, 0x81, 0xFF, 0x00, 0x00, 0x0D,
+  0x00, 0x00, 0xC0, 0x80, 0x00, 0x4A, 0x00, 0x08, 0x80, 0x00, 0x00, 0x48,
+  0x0A, 0x80, 0x00, 0x00, 0xB7, 0x12, 0x80, 0x00, 0x00, 0x49, 0x03, 0x80,
+  0xCD, 0x00, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0xB6, 0x09, 0x80, 0x32, 0x00,
+  0x00, 0xC0, 0x80, 0x00, 0x64, 0x00, 0x08, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF4, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0x11, 0x80,
+  0x00, 0x00, 0x04, 0x03, 0x80, 0xA5, 0x00, 0xFF, 0x00, 0x80, 0xFF, 0x00,
+  0xFB, 0x09, 0x80, 0x5A, 0x00, 0x00, 0xC0, 0x80, 0x00, 0x7D, 0x00, 0x09,
+  0x80, 0x00, 0x00, 0xA1, 0x0A, 0x80, 0x00, 0x00, 0x5E, 0x11, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0x02, 0x80, 0x7E, 0x00, 0xFF, 0x00, 0x81,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x40, 0x08, 0x80, 0x81, 0x00, 0x00, 0xC0,
+  0x80, 0x00, 0x95, 0x00, 0x09, 0x80, 0x00, 0x00, 0x52, 0x0A, 0x80, 0x00,
+  0x00, 0xAD, 0x12, 0x80, 0x00, 0x00, 0x7E, 0x02, 0x80, 0x59, 0x00, 0xFF,
+  0x01, 0x80, 0xFF, 0x00, 0x81, 0x08, 0x80, 0xA6, 0x00, 0x00, 0xC0, 0x80,
+  0x00, 0xAF, 0x00, 0x09, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00,
+  0xFF, 0x12, 0x80, 0x00, 0x00, 0x3A, 0x02, 0x80, 0x31, 0x00, 0xFF, 0x01,
+  0x80, 0xFF, 0x00, 0xC5, 0x08, 0x80, 0xCE, 0x00, 0x00, 0xC0, 0x80, 0x00,
+  0xC8, 0x00, 0x0A, 0x80, 0x00, 0x00, 0xAB, 0x0A, 0x80, 0x00, 0x00, 0x54,
+  0x11, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x01, 0x80, 0x0A, 0x00,
+  0xFF, 0x01, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x0A, 0x07, 0x80, 0xF5,
+  0x00, 0x00, 0xC0, 0x80, 0x00, 0xE0, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x5C,
+  0x0A, 0x80, 0x00, 0x00, 0xA3, 0x12, 0x80, 0x00, 0x00, 0xB4, 0x01, 0x81,
+  0x00, 0x00, 0xFF, 0xE3, 0x00, 0xFF, 0x01, 0x80, 0xFF, 0x00, 0x4B, 0x07,
+  0x81, 0xFF, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xC0, 0x80, 0x00, 0xF9, 0x00,
+  0x0A, 0x80, 0x00, 0x00, 0x09, 0x0A, 0x80, 0x00, 0x00, 0xF6, 0x12, 0x80,
+  0x00, 0x00, 0x70, 0x02, 0x80, 0xBC, 0x00, 0xFF, 0x01, 0x80, 0xFF, 0x00,
+  0x8F, 0x08, 0x80, 0x43, 0x00, 0x00, 0xC0, 0x81, 0x00, 0xFF, 0x00, 0x00,
+  0x14, 0x00, 0x09, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x09, 0x81,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x4A, 0x11, 0x80, 0x00, 0x00, 0x2B, 0x02,
+  0x80, 0x94, 0x00, 0xFF, 0x01, 0x80, 0xFF, 0x00, 0xD4, 0x08, 0x80, 0x6B,
+  0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x2C, 0x00, 0x0A, 0x80, 0x00, 0x00,
+  0x67, 0x0A, 0x80, 0x00, 0x00, 0x98, 0x11, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xEA, 0x01, 0x80, 0x6F, 0x00, 0xFF, 0x01, 0x81, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0x15, 0x07, 0x80, 0x90, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00,
+  0x45, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x13, 0x0A, 0x80, 0x00, 0x00, 0xEC,
+  0x12, 0x80, 0x00, 0x00, 0xA6, 0x01, 0x80, 0x48, 0x00, 0xFF, 0x02, 0x80,
+  0xFF, 0x00, 0x59, 0x07, 0x80, 0xB7, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00,
+  0x5F, 0x00, 0x0A, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x09, 0x81,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x11, 0x80, 0x00, 0x00, 0x61, 0x01,
+  0x80, 0x20, 0x00, 0xFF, 0x02, 0x80, 0xFF, 0x00, 0x9E, 0x07, 0x80, 0xDF,
+  0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x77, 0x00, 0x0B, 0x80, 0x00, 0x00,
+  0x71, 0x0A, 0x80, 0x00, 0x00, 0x8E, 0x11, 0x80, 0x00, 0x00, 0x20, 0x01,
+  0x81, 0x00, 0x00, 0xFF, 0xFA, 0x00, 0xFF, 0x01, 0x80, 0xFF, 0x00, 0xDF,
+  0x07, 0x81, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00,
+  0x90, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1D, 0x0A, 0x80, 0x00, 0x00, 0xE2,
+  0x11, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x01, 0x80, 0xD2, 0x00,
+  0xFF, 0x01, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x23, 0x07, 0x80, 0x2D,
+  0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0xAA, 0x00, 0x0B, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xCA, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x35,
+  0x11, 0x80, 0x00, 0x00, 0x97, 0x01, 0x80, 0xAB, 0x00, 0xFF, 0x02, 0x80,
+  0xFF, 0x00, 0x68, 0x07, 0x80, 0x54, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00,
+  0xC2, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x7B, 0x0A, 0x80, 0x00, 0x00, 0x84,
+  0x11, 0x80, 0x00, 0x00, 0x56, 0x01, 0x80, 0x85, 0x00, 0xFF, 0x02, 0x80,
+  0xFF, 0x00, 0xA9, 0x07, 0x80, 0x7A, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00,
+  0xDB, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x28, 0x0A, 0x80, 0x00, 0x00, 0xD7,
+  0x11, 0x80, 0x00, 0x00, 0x12, 0x01, 0x80, 0x5E, 0x00, 0xFF, 0x02, 0x80,
+  0xFF, 0x00, 0xED, 0x07, 0x80, 0xA1, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00,
+  0xF4, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x09, 0x81,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x2B, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xCD, 0x00, 0x80, 0x36, 0x00, 0xFF, 0x02, 0x81, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0x32, 0x06, 0x80, 0xC9, 0x00, 0x00, 0xC0, 0x00, 0x81, 0x00,
+  0xFF, 0x00, 0x00, 0x0D, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x85, 0x0A, 0x80,
+  0x00, 0x00, 0x7A, 0x11, 0x80, 0x00, 0x00, 0x8C, 0x00, 0x80, 0x11, 0x00,
+  0xFF, 0x03, 0x80, 0xFF, 0x00, 0x73, 0x06, 0x80, 0xEE, 0x00, 0x00, 0xC0,
+  0x01, 0x80, 0x00, 0x27, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x32, 0x0A, 0x80,
+  0x00, 0x00, 0xCD, 0x11, 0x80, 0x00, 0x00, 0x48, 0x00, 0x81, 0x00, 0x00,
+  0xFF, 0xE9, 0x00, 0xFF, 0x02, 0x80, 0xFF, 0x00, 0xB7, 0x06, 0x81, 0xFF,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x00, 0x40, 0x00, 0x0C,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x09, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x21, 0x10, 0x80, 0x00, 0x00, 0x03, 0x01, 0x80, 0xC1, 0x00,
+  0xFF, 0x02, 0x80, 0xFF, 0x00, 0xFC, 0x07, 0x80, 0x3E, 0x00, 0x00, 0xC0,
+  0x01, 0x80, 0x00, 0x58, 0x00, 0x0D, 0x80, 0x00, 0x00, 0x8F, 0x0A, 0x80,
+  0x00, 0x00, 0x70, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x00,
+  0x80, 0x9C, 0x00, 0xFF, 0x02, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x3D,
+  0x06, 0x80, 0x63, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x00, 0x72, 0x00, 0x0D,
+  0x80, 0x00, 0x00, 0x3C, 0x0A, 0x80, 0x00, 0x00, 0xC3, 0x11, 0x80, 0x00,
+  0x00, 0x7E, 0x00, 0x80, 0x74, 0x00, 0xFF, 0x03, 0x80, 0xFF, 0x00, 0x81,
+  0x06, 0x80, 0x8B, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x00, 0x8B, 0x00, 0x0D,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x09, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x17, 0x10, 0x80, 0x00, 0x00, 0x39, 0x00, 0x80, 0x4D, 0x00,
+  0xFF, 0x03, 0x80, 0xFF, 0x00, 0xC6, 0x06, 0x80, 0xB2, 0x00, 0x00, 0xC0,
+  0x01, 0x80, 0x00, 0xA3, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x9A, 0x0A, 0x80,
+  0x00, 0x00, 0x65, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x28,
+  0x00, 0xFF, 0x03, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x05, 0x80,
+  0xD7, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x00, 0xBD, 0x00, 0x0E, 0x80, 0x00,
+  0x00, 0x46, 0x0A, 0x80, 0x00, 0x00, 0xB9, 0x11, 0x81, 0x00, 0x00, 0xB4,
+  0x00, 0x00, 0xFF, 0x04, 0x80, 0xFF, 0x00, 0x4B, 0x05, 0x80, 0xFF, 0x00,
+  0x00, 0xC0, 0x01, 0x80, 0x00, 0xD6, 0x00, 0x0E, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF3, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0C, 0x10,
+  0x80, 0x00, 0x00, 0x6F, 0x00, 0x80, 0xD7, 0x00, 0xFF, 0x03, 0x80, 0xFF,
+  0x00, 0x90, 0x06, 0x80, 0x28, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x00, 0xEE,
+  0x00, 0x0F, 0x80, 0x00, 0x00, 0xA4, 0x0A, 0x80, 0x00, 0x00, 0x5B, 0x10,
+  0x80, 0x00, 0x00, 0x2E, 0x00, 0x80, 0xB2, 0x00, 0xFF, 0x03, 0x80, 0xFF,
+  0x00, 0xD1, 0x06, 0x80, 0x4D, 0x00, 0x00, 0xC0, 0x01, 0x81, 0x00, 0xFF,
+  0x00, 0x00, 0x08, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x50, 0x0A, 0x80, 0x00,
+  0x00, 0xAF, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x8B, 0x00,
+  0xFF, 0x03, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x15, 0x05, 0x80, 0x74,
+  0x00, 0x00, 0xC0, 0x02, 0x80, 0x00, 0x22, 0x00, 0x0E, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFD, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02,
+  0x10, 0x81, 0x00, 0x00, 0xA5, 0x63, 0x00, 0xFF, 0x04, 0x80, 0xFF, 0x00,
+  0x5A, 0x05, 0x80, 0x9C, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x00, 0x3A, 0x00,
+  0x0F, 0x80, 0x00, 0x00, 0xAE, 0x0A, 0x80, 0x00, 0x00, 0x51, 0x10, 0x81,
+  0x00, 0x00, 0x64, 0x3E, 0x00, 0xFF, 0x04, 0x80, 0xFF, 0x00, 0x9B, 0x05,
+  0x80, 0xC1, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x00, 0x53, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x5B, 0x0A, 0x80, 0x00, 0x00, 0xA4, 0x10, 0x81, 0x00, 0x00,
+  0x20, 0x16, 0x00, 0xFF, 0x04, 0x80, 0xFF, 0x00, 0xDF, 0x05, 0x80, 0xE9,
+  0x00, 0x00, 0xC0, 0x02, 0x80, 0x00, 0x6D, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x07, 0x0A, 0x80, 0x00, 0x00, 0xF8, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xDB, 0xEE, 0x00, 0xFF, 0x03, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0x24, 0x04, 0x81, 0xFF, 0x00, 0x00, 0x11, 0x00, 0x00, 0xC0, 0x02, 0x80,
+  0x00, 0x85, 0x00, 0x0F, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x09,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x47, 0x10, 0x81, 0x00, 0x00, 0x9A,
+  0xC9, 0x00, 0xFF, 0x04, 0x80, 0xFF, 0x00, 0x65, 0x05, 0x80, 0x36, 0x00,
+  0x00, 0xC0, 0x02, 0x80, 0x00, 0x9E, 0x00, 0x10, 0x80, 0x00, 0x00, 0x65,
+  0x0A, 0x80, 0x00, 0x00, 0x9A, 0x10, 0x81, 0x00, 0x00, 0x56, 0xA1, 0x00,
+  0xFF, 0x04, 0x80, 0xFF, 0x00, 0xA9, 0x05, 0x80, 0x5E, 0x00, 0x00, 0xC0,
+  0x02, 0x80, 0x00, 0xB8, 0x00, 0x10, 0x80, 0x00, 0x00, 0x11, 0x0A, 0x80,
+  0x00, 0x00, 0xEE, 0x10, 0x81, 0x00, 0x00, 0x11, 0x79, 0x00, 0xFF, 0x04,
+  0x80, 0xFF, 0x00, 0xEE, 0x05, 0x80, 0x86, 0x00, 0x00, 0xC0, 0x02, 0x80,
+  0x00, 0xCF, 0x00, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x09,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x0F, 0x81, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0xD0, 0x04, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x2F, 0x04,
+  0x80, 0xAB, 0x00, 0x00, 0xC0, 0x02, 0x80, 0x00, 0xE9, 0x00, 0x11, 0x80,
+  0x00, 0x00, 0x6F, 0x0A, 0x80, 0x00, 0x00, 0x90, 0x10, 0x80, 0x2D, 0x00,
+  0x8C, 0x05, 0x80, 0xFF, 0x00, 0x73, 0x04, 0x80, 0xD2, 0x00, 0x00, 0xC0,
+  0x02, 0x81, 0x00, 0xFF, 0x00, 0x00, 0x03, 0x00, 0x10, 0x80, 0x00, 0x00,
+  0x1B, 0x0A, 0x80, 0x00, 0x00, 0xE4, 0x10, 0x80, 0x05, 0x00, 0x47, 0x05,
+  0x80, 0xFF, 0x00, 0xB8, 0x04, 0x80, 0xFA, 0x00, 0x00, 0xC0, 0x03, 0x80,
+  0x00, 0x1B, 0x00, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x09,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x32, 0x0F, 0x81, 0x00, 0x00, 0x06,
+  0xDF, 0x00, 0xFF, 0x04, 0x80, 0xFF, 0x00, 0xF9, 0x04, 0x81, 0xFF, 0x00,
+  0x00, 0x20, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x35, 0x00, 0x11, 0x80,
+  0x00, 0x00, 0x79, 0x0A, 0x80, 0x00, 0x00, 0x86, 0x0F, 0x81, 0x00, 0x00,
+  0x00, 0xB7, 0x00, 0xC2, 0x04, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x3D,
+  0x04, 0x80, 0x48, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x4E, 0x00, 0x11,
+  0x80, 0x00, 0x00, 0x26, 0x0A, 0x80, 0x00, 0x00, 0xD9, 0x10, 0x80, 0x90,
+  0x00, 0x7D, 0x05, 0x80, 0xFF, 0x00, 0x82, 0x04, 0x80, 0x6F, 0x00, 0x00,
+  0xC0, 0x03, 0x80, 0x00, 0x66, 0x00, 0x11, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xD7, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x28, 0x0F, 0x80,
+  0x6B, 0x00, 0x3C, 0x05, 0x80, 0xFF, 0x00, 0xC3, 0x04, 0x80, 0x94, 0x00,
+  0x00, 0xC0, 0x03, 0x80, 0x00, 0x80, 0x00, 0x12, 0x80, 0x00, 0x00, 0x83,
+  0x0A, 0x80, 0x00, 0x00, 0x7C, 0x0F, 0x81, 0x43, 0x00, 0x00, 0xFF, 0x00,
+  0xF8, 0x04, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x03, 0x80, 0xBC,
+  0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x99, 0x00, 0x12, 0x80, 0x00, 0x00,
+  0x30, 0x0A, 0x80, 0x00, 0x00, 0xCF, 0x0F, 0x81, 0x1C, 0x00, 0x00, 0xFF,
+  0x00, 0xB3, 0x05, 0x80, 0xFF, 0x00, 0x4C, 0x03, 0x80, 0xE3, 0x00, 0x00,
+  0xC0, 0x03, 0x80, 0x00, 0xB1, 0x00, 0x12, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xE1, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x0E, 0x81,
+  0x00, 0x00, 0x00, 0xF5, 0x00, 0x72, 0x05, 0x80, 0xFF, 0x00, 0x8D, 0x03,
+  0x81, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xCA,
+  0x00, 0x13, 0x80, 0x00, 0x00, 0x8E, 0x0A, 0x80, 0x00, 0x00, 0x71, 0x0F,
+  0x80, 0xCE, 0x00, 0x2E, 0x05, 0x80, 0xFF, 0x00, 0xD1, 0x04, 0x80, 0x31,
+  0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xE4, 0x00, 0x13, 0x80, 0x00, 0x00,
+  0x3A, 0x0A, 0x80, 0x00, 0x00, 0xC5, 0x0F, 0x81, 0xA6, 0x00, 0x00, 0xFF,
+  0x00, 0xE9, 0x04, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0x03, 0x80,
+  0x59, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xFC, 0x00, 0x13, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xEB, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x14, 0x0E, 0x81, 0x81, 0x00, 0x00, 0xFF, 0x00, 0xA8, 0x05, 0x80, 0xFF,
+  0x00, 0x57, 0x03, 0x80, 0x7E, 0x00, 0x00, 0xC0, 0x03, 0x81, 0x00, 0xFF,
+  0x00, 0x00, 0x16, 0x00, 0x13, 0x80, 0x00, 0x00, 0x98, 0x0A, 0x80, 0x00,
+  0x00, 0x67, 0x0E, 0x81, 0x59, 0x00, 0x00, 0xFF, 0x00, 0x64, 0x05, 0x80,
+  0xFF, 0x00, 0x9B, 0x03, 0x80, 0xA6, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00,
+  0x30, 0x00, 0x13, 0x80, 0x00, 0x00, 0x44, 0x0A, 0x80, 0x00, 0x00, 0xBB,
+  0x0E, 0x81, 0x32, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0x05, 0x80, 0xFF, 0x00,
+  0xE0, 0x03, 0x80, 0xCD, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0x48, 0x00,
+  0x13, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x09, 0x81, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x09, 0x0D, 0x82, 0x0D, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0xDE, 0x04, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x21, 0x02,
+  0x80, 0xF2, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0x61, 0x00, 0x14, 0x80,
+  0x00, 0x00, 0xA2, 0x0A, 0x80, 0x00, 0x00, 0x5D, 0x0D, 0x82, 0x00, 0x00,
+  0x00, 0xE4, 0x00, 0x00, 0xFF, 0x00, 0x9A, 0x05, 0x80, 0xFF, 0x00, 0x65,
+  0x02, 0x81, 0xFF, 0x00, 0x00, 0x1B, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00,
+  0x7B, 0x00, 0x14, 0x80, 0x00, 0x00, 0x4E, 0x0A, 0x80, 0x00, 0x00, 0xB1,
+  0x0E, 0x81, 0xBD, 0x00, 0x00, 0xFF, 0x00, 0x55, 0x05, 0x80, 0xFF, 0x00,
+  0xAA, 0x03, 0x80, 0x42, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0x93, 0x00,
+  0x14, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0xFF, 0x0E, 0x81,
+  0x97, 0x00, 0x00, 0xFF, 0x00, 0x14, 0x05, 0x80, 0xFF, 0x00, 0xEB, 0x03,
+  0x80, 0x68, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00, 0xAC, 0x00, 0x15, 0x80,
+  0x00, 0x00, 0xAC, 0x0A, 0x80, 0x00, 0x00, 0x53, 0x0D, 0x82, 0x70, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xD0, 0x04, 0x81, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0x2F, 0x02, 0x80, 0x8F, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00,
+  0xC5, 0x00, 0x15, 0x80, 0x00, 0x00, 0x59, 0x0A, 0x80, 0x00, 0x00, 0xA6,
+  0x0D, 0x80, 0x48, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x8B, 0x05, 0x80,
+  0xFF, 0x00, 0x74, 0x02, 0x80, 0xB7, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00,
+  0xDD, 0x00, 0x15, 0x80, 0x00, 0x00, 0x0A, 0x0A, 0x80, 0x00, 0x00, 0xF5,
+  0x0D, 0x80, 0x23, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x4A, 0x05, 0x80,
+  0xFF, 0x00, 0xB5, 0x02, 0x80, 0xDC, 0x00, 0x00, 0xC0, 0x04, 0x80, 0x00,
+  0xF7, 0x00, 0x15, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x09, 0x81,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x49, 0x0C, 0x82, 0x00, 0x00, 0x00, 0xFB,
+  0x00, 0x00, 0xFF, 0x00, 0x06, 0x05, 0x80, 0xFF, 0x00, 0xF9, 0x02, 0x81,
+  0xFF, 0x00, 0x00, 0x04, 0x00, 0x00, 0xC0, 0x04, 0x81, 0x00, 0xFF, 0x00,
+  0x00, 0x11, 0x00, 0x15, 0x80, 0x00, 0x00, 0x63, 0x0A, 0x80, 0x00, 0x00,
+  0x9C, 0x0D, 0x82, 0xD3, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xC1,
+  0x04, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x3E, 0x02, 0x80, 0x2C, 0x00,
+  0x00, 0xC0, 0x05, 0x80, 0x00, 0x29, 0x00, 0x15, 0x80, 0x00, 0x00, 0x14,
+  0x0A, 0x80, 0x00, 0x00, 0xEB, 0x0D, 0x80, 0xAE, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0x00, 0x80, 0x05, 0x80, 0xFF, 0x00, 0x7F, 0x02, 0x80, 0x51, 0x00,
+  0x00, 0xC0, 0x05, 0x80, 0x00, 0x43, 0x00, 0x15, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xC1, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3E, 0x0C,
+  0x80, 0x86, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x3C, 0x05, 0x80, 0xFF,
+  0x00, 0xC3, 0x02, 0x80, 0x79, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x00, 0x5C,
+  0x00, 0x16, 0x80, 0x00, 0x00, 0x6D, 0x0A, 0x80, 0x00, 0x00, 0x92, 0x0C,
+  0x80, 0x5F, 0x00, 0x00, 0x00, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xF7,
+  0x04, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0x01, 0x80, 0xA0, 0x00,
+  0x00, 0xC0, 0x05, 0x80, 0x00, 0x74, 0x00, 0x16, 0x80, 0x00, 0x00, 0x1E,
+  0x0A, 0x80, 0x00, 0x00, 0xE1, 0x0C, 0x80, 0x39, 0x00, 0x00, 0x01, 0x80,
+  0xFF, 0x00, 0xB6, 0x05, 0x80, 0xFF, 0x00, 0x49, 0x01, 0x80, 0xC6, 0x00,
+  0x00, 0xC0, 0x05, 0x80, 0x00, 0x8E, 0x00, 0x16, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xCB, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x34, 0x0B,
+  0x80, 0x12, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x00, 0x71, 0x05, 0x80, 0xFF,
+  0x00, 0x8E, 0x01, 0x80, 0xED, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x00, 0xA7,
+  0x00, 0x17, 0x80, 0x00, 0x00, 0x77, 0x0A, 0x80, 0x00, 0x00, 0x88, 0x0B,
+  0x81, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x2D,
+  0x05, 0x80, 0xFF, 0x00, 0xD2, 0x01, 0x81, 0xFF, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0xC0, 0x05, 0x80, 0x00, 0xBF, 0x00, 0x17, 0x80, 0x00, 0x00, 0x29,
+  0x0A, 0x80, 0x00, 0x00, 0xD6, 0x0C, 0x80, 0xC4, 0x00, 0x00, 0x00, 0x81,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xEC, 0x04, 0x81, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0x13, 0x01, 0x80, 0x3B, 0x00, 0x00, 0xC0, 0x05, 0x80, 0x00, 0xD8,
+  0x00, 0x17, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x09, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x2A, 0x0B, 0x80, 0x9D, 0x00, 0x00, 0x01, 0x80,
+  0xFF, 0x00, 0xA7, 0x05, 0x80, 0xFF, 0x00, 0x58, 0x01, 0x80, 0x62, 0x00,
+  0x00, 0xC0, 0x05, 0x80, 0x00, 0xF2, 0x00, 0x18, 0x80, 0x00, 0x00, 0x81,
+  0x0A, 0x80, 0x00, 0x00, 0x7E, 0x0B, 0x80, 0x75, 0x00, 0x00, 0x01, 0x80,
+  0xFF, 0x00, 0x63, 0x05, 0x80, 0xFF, 0x00, 0x9C, 0x01, 0x80, 0x8A, 0x00,
+  0x00, 0xC0, 0x05, 0x81, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0x00, 0x17, 0x80,
+  0x00, 0x00, 0x33, 0x0A, 0x80, 0x00, 0x00, 0xCC, 0x0B, 0x80, 0x50, 0x00,
+  0x00, 0x01, 0x80, 0xFF, 0x00, 0x22, 0x05, 0x80, 0xFF, 0x00, 0xDD, 0x01,
+  0x80, 0xAF, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x00, 0x24, 0x00, 0x17, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x20, 0x0A, 0x80, 0x28, 0x00, 0x00, 0x01, 0x81, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0xDD, 0x04, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x22, 0x00,
+  0x80, 0xD7, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x00, 0x3E, 0x00, 0x18, 0x80,
+  0x00, 0x00, 0x8C, 0x0A, 0x80, 0x00, 0x00, 0x73, 0x0A, 0x80, 0x01, 0x00,
+  0x00, 0x02, 0x80, 0xFF, 0x00, 0x99, 0x05, 0x80, 0xFF, 0x00, 0x66, 0x00,
+  0x80, 0xFE, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x00, 0x56, 0x00, 0x18, 0x80,
+  0x00, 0x00, 0x3D, 0x0A, 0x80, 0x00, 0x00, 0xC2, 0x0A, 0x81, 0x00, 0x00,
+  0x00, 0xDB, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x00, 0x58, 0x05, 0x80, 0xFF,
+  0x00, 0xA7, 0x00, 0x81, 0xFF, 0x00, 0x00, 0x24, 0x00, 0x00, 0xC0, 0x06,
+  0x80, 0x00, 0x6F, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9,
+  0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x16, 0x0A, 0x80, 0xB3, 0x00,
+  0x00, 0x01, 0x80, 0xFF, 0x00, 0x13, 0x05, 0x80, 0xFF, 0x00, 0xEC, 0x01,
+  0x80, 0x4C, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x00, 0x88, 0x00, 0x19, 0x80,
+  0x00, 0x00, 0x96, 0x0A, 0x80, 0x00, 0x00, 0x69, 0x0A, 0x80, 0x8B, 0x00,
+  0x00, 0x01, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xCF, 0x04, 0x81, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0x30, 0x00, 0x80, 0x74, 0x00, 0x00, 0xC0, 0x06,
+  0x80, 0x00, 0xA0, 0x00, 0x19, 0x80, 0x00, 0x00, 0x47, 0x0A, 0x80, 0x00,
+  0x00, 0xB8, 0x0A, 0x80, 0x66, 0x00, 0x00, 0x02, 0x80, 0xFF, 0x00, 0x8E,
+  0x05, 0x80, 0xFF, 0x00, 0x71, 0x00, 0x80, 0x99, 0x00, 0x00, 0xC0, 0x06,
+  0x80, 0x00, 0xBA, 0x00, 0x19, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+  0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0x09, 0x80, 0x3F, 0x00,
+  0x00, 0x02, 0x80, 0xFF, 0x00, 0x49, 0x05, 0x80, 0xFF, 0x00, 0xB6, 0x00,
+  0x80, 0xC0, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x00, 0xD3, 0x00, 0x1A, 0x80,
+  0x00, 0x00, 0xA0, 0x0A, 0x80, 0x00, 0x00, 0x5F, 0x09, 0x80, 0x17, 0x00,
+  0x00, 0x02, 0x80, 0xFF, 0x00, 0x05, 0x05, 0x80, 0xFF, 0x00, 0xFA, 0x00,
+  0x80, 0xE8, 0x00, 0x00, 0xC0, 0x06, 0x80, 0x00, 0xEB, 0x00, 0x1A, 0x80,
+  0x00, 0x00, 0x51, 0x0A, 0x80, 0x00, 0x00, 0xAE, 0x09, 0x81, 0x00, 0x00,
+  0x00, 0xF1, 0x00, 0x00, 0x01, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xC4,
+  0x04, 0x83, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0xC0, 0x06, 0x81, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x00, 0x19,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x09, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x01, 0x09, 0x80, 0xC9, 0x00, 0x00, 0x02, 0x80, 0xFF, 0x00,
+  0x7F, 0x05, 0x80, 0xFF, 0x00, 0x80, 0x00, 0x80, 0x36, 0x00, 0x00, 0xC0,
+  0x07, 0x80, 0x00, 0x1F, 0x00, 0x1A, 0x80, 0x00, 0x00, 0xAA, 0x0A, 0x80,
+  0x00, 0x00, 0x55, 0x09, 0x80, 0xA2, 0x00, 0x00, 0x02, 0x80, 0xFF, 0x00,
+  0x3B, 0x05, 0x80, 0xFF, 0x00, 0xC4, 0x00, 0x80, 0x5D, 0x00, 0x00, 0xC0,
+  0x07, 0x80, 0x00, 0x37, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x5C, 0x0A, 0x80,
+  0x00, 0x00, 0xA3, 0x09, 0x80, 0x7D, 0x00, 0x00, 0x02, 0x81, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0xFA, 0x04, 0x82, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x05,
+  0x82, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x00, 0x51, 0x00, 0x1A, 0x80, 0x00,
+  0x00, 0x08, 0x0A, 0x80, 0x00, 0x00, 0xF7, 0x09, 0x80, 0x55, 0x00, 0x00,
+  0x03, 0x80, 0xFF, 0x00, 0xB5, 0x05, 0x81, 0xFF, 0x00, 0x4A, 0xAA, 0x00,
+  0x00, 0xC0, 0x07, 0x80, 0x00, 0x6A, 0x00, 0x1A, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xB4, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x4B, 0x08,
+  0x80, 0x2E, 0x00, 0x00, 0x03, 0x80, 0xFF, 0x00, 0x71, 0x05, 0x81, 0xFF,
+  0x00, 0x8E, 0xD1, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x00, 0x82, 0x00, 0x1B,
+  0x80, 0x00, 0x00, 0x66, 0x0A, 0x80, 0x00, 0x00, 0x99, 0x08, 0x80, 0x08,
+  0x00, 0x00, 0x03, 0x80, 0xFF, 0x00, 0x30, 0x05, 0x81, 0xFF, 0x00, 0xCF,
+  0xF7, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x00, 0x9B, 0x00, 0x1B, 0x80, 0x00,
+  0x00, 0x12, 0x0A, 0x80, 0x00, 0x00, 0xED, 0x08, 0x81, 0x00, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x02, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xEB, 0x04,
+  0x82, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x1F, 0x00, 0x00, 0xC0, 0x07,
+  0x80, 0x00, 0xB5, 0x00, 0x1B, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x40, 0x08, 0x80, 0xB8, 0x00,
+  0x00, 0x03, 0x80, 0xFF, 0x00, 0xA7, 0x05, 0x81, 0xFF, 0x00, 0x58, 0x47,
+  0x00, 0x00, 0xC0, 0x07, 0x80, 0x00, 0xCD, 0x00, 0x1C, 0x80, 0x00, 0x00,
+  0x70, 0x0A, 0x80, 0x00, 0x00, 0x8F, 0x08, 0x80, 0x93, 0x00, 0x00, 0x03,
+  0x80, 0xFF, 0x00, 0x66, 0x05, 0x81, 0xFF, 0x00, 0x99, 0x6C, 0x00, 0x00,
+  0xC0, 0x07, 0x80, 0x00, 0xE6, 0x00, 0x1C, 0x80, 0x00, 0x00, 0x1C, 0x0A,
+  0x80, 0x00, 0x00, 0xE3, 0x08, 0x80, 0x6B, 0x00, 0x00, 0x03, 0x80, 0xFF,
+  0x00, 0x21, 0x05, 0x81, 0xFF, 0x00, 0xDE, 0x94, 0x00, 0x00, 0xC0, 0x07,
+  0x81, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x1B, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xC9, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x36, 0x07,
+  0x80, 0x44, 0x00, 0x00, 0x03, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xDD,
+  0x04, 0x81, 0xFF, 0x00, 0xFF, 0xBB, 0x00, 0x22, 0xC0, 0x08, 0x80, 0x00,
+  0x19, 0x00, 0x1C, 0x80, 0x00, 0x00, 0x7A, 0x0A, 0x80, 0x00, 0x00, 0x85,
+  0x07, 0x80, 0x1F, 0x00, 0x00, 0x04, 0x80, 0xFF, 0x00, 0x9C, 0x05, 0x80,
+  0xE0, 0x00, 0x63, 0xC0, 0x08, 0x80, 0x00, 0x32, 0x00, 0x1C, 0x80, 0x00,
+  0x00, 0x27, 0x0A, 0x80, 0x00, 0x00, 0xD8, 0x07, 0x81, 0x00, 0x00, 0x00,
+  0xF6, 0x00, 0x00, 0x03, 0x80, 0xFF, 0x00, 0x57, 0x05, 0x81, 0xFF, 0x00,
+  0xA8, 0x09, 0x00, 0x00, 0xC0, 0x08, 0x80, 0x00, 0x4C, 0x00, 0x1C, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x2C, 0x07, 0x80, 0xCF, 0x00, 0x00, 0x03, 0x80, 0xFF, 0x00, 0x13,
+  0x05, 0x81, 0xFF, 0x00, 0xEC, 0x30, 0x00, 0x00, 0xC0, 0x08, 0x80, 0x00,
+  0x63, 0x00, 0x1D, 0x80, 0x00, 0x00, 0x84, 0x0A, 0x80, 0x00, 0x00, 0x7B,
+  0x07, 0x80, 0xA9, 0x00, 0x00, 0x03, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0xD2, 0x04, 0x81, 0xFF, 0x00, 0xFF, 0x56, 0x00, 0x2D, 0xC0, 0x08, 0x80,
+  0x00, 0x7D, 0x00, 0x1D, 0x80, 0x00, 0x00, 0x31, 0x0A, 0x80, 0x00, 0x00,
+  0xCE, 0x07, 0x80, 0x82, 0x00, 0x00, 0x04, 0x80, 0xFF, 0x00, 0x8D, 0x05,
+  0x80, 0x7D, 0x00, 0x72, 0xC0, 0x08, 0x80, 0x00, 0x96, 0x00, 0x1D, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x22, 0x06, 0x80, 0x5A, 0x00, 0x00, 0x04, 0x80, 0xFF, 0x00, 0x49,
+  0x05, 0x80, 0xA5, 0x00, 0xB6, 0xC0, 0x08, 0x80, 0x00, 0xAE, 0x00, 0x1E,
+  0x80, 0x00, 0x00, 0x8F, 0x0A, 0x80, 0x00, 0x00, 0x70, 0x06, 0x80, 0x35,
+  0x00, 0x00, 0x04, 0x80, 0xFF, 0x00, 0x08, 0x05, 0x80, 0xCA, 0x00, 0xF7,
+  0xC0, 0x08, 0x80, 0x00, 0xC8, 0x00, 0x1E, 0x80, 0x00, 0x00, 0x3B, 0x0A,
+  0x80, 0x00, 0x00, 0xC4, 0x06, 0x80, 0x0E, 0x00, 0x00, 0x04, 0x81, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0xC3, 0x04, 0x81, 0xF1, 0x00, 0xFF, 0x00, 0x00,
+  0x3C, 0xC0, 0x08, 0x80, 0x00, 0xE1, 0x00, 0x1E, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xE8, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x17, 0x05,
+  0x81, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x04, 0x80, 0xFF, 0x00, 0x7F,
+  0x04, 0x81, 0xFF, 0x00, 0xFF, 0x1A, 0x00, 0x80, 0xC0, 0x08, 0x80, 0x00,
+  0xF9, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x99, 0x0A, 0x80, 0x00, 0x00, 0x66,
+  0x06, 0x80, 0xC0, 0x00, 0x00, 0x04, 0x80, 0xFF, 0x00, 0x3E, 0x05, 0x80,
+  0x3F, 0x00, 0xC1, 0xC0, 0x08, 0x81, 0x00, 0xFF, 0x00, 0x00, 0x14, 0x00,
+  0x1E, 0x80, 0x00, 0x00, 0x45, 0x0A, 0x80, 0x00, 0x00, 0xBA, 0x06, 0x80,
+  0x98, 0x00, 0x00, 0x04, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xF9, 0x04,
+  0x81, 0x67, 0x00, 0xFF, 0x00, 0x00, 0x06, 0xC0, 0x09, 0x80, 0x00, 0x2D,
+  0x00, 0x1E, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x09, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x0D, 0x05, 0x80, 0x71, 0x00, 0x00, 0x05, 0x80,
+  0xFF, 0x00, 0xB5, 0x04, 0x81, 0x8E, 0x00, 0xFF, 0x00, 0x00, 0x4A, 0xC0,
+  0x09, 0x80, 0x00, 0x45, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xA3, 0x0A, 0x80,
+  0x00, 0x00, 0x5C, 0x05, 0x80, 0x4B, 0x00, 0x00, 0x05, 0x80, 0xFF, 0x00,
+  0x74, 0x04, 0x81, 0xB4, 0x00, 0xFF, 0x00, 0x00, 0x8B, 0xC0, 0x09, 0x80,
+  0x00, 0x5E, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x50, 0x0A, 0x80, 0x00, 0x00,
+  0xAF, 0x05, 0x80, 0x24, 0x00, 0x00, 0x05, 0x80, 0xFF, 0x00, 0x2F, 0x04,
+  0x81, 0xDB, 0x00, 0xFF, 0x00, 0x00, 0xD0, 0xC0, 0x09, 0x80, 0x00, 0x78,
+  0x00, 0x1F, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x09, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x03, 0x04, 0x81, 0x00, 0x00, 0x00, 0xFB, 0x00,
+  0x00, 0x04, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xEB, 0x03, 0x82, 0xFF,
+  0x00, 0xFF, 0x04, 0x00, 0xFF, 0x00, 0x00, 0x14, 0xC0, 0x09, 0x80, 0x00,
+  0x90, 0x00, 0x20, 0x80, 0x00, 0x00, 0xAD, 0x0A, 0x80, 0x00, 0x00, 0x52,
+  0x05, 0x80, 0xD6, 0x00, 0x00, 0x05, 0x80, 0xFF, 0x00, 0xAA, 0x04, 0x81,
+  0x29, 0x00, 0xFF, 0x00, 0x00, 0x55, 0xC0, 0x09, 0x80, 0x00, 0xA9, 0x00,
+  0x20, 0x80, 0x00, 0x00, 0x5A, 0x0A, 0x80, 0x00, 0x00, 0xA5, 0x05, 0x80,
+  0xAF, 0x00, 0x00, 0x05, 0x80, 0xFF, 0x00, 0x65, 0x04, 0x81, 0x50, 0x00,
+  0xFF, 0x00, 0x00, 0x9A, 0xC0, 0x09, 0x80, 0x00, 0xC1, 0x00, 0x20, 0x80,
+  0x00, 0x00, 0x0B, 0x0A, 0x80, 0x00, 0x00, 0xF4, 0x05, 0x80, 0x89, 0x00,
+  0x00, 0x05, 0x80, 0xFF, 0x00, 0x25, 0x04, 0x81, 0x76, 0x00, 0xFF, 0x00,
+  0x00, 0xDA, 0xC0, 0x09, 0x80, 0x00, 0xDB, 0x00, 0x20, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xB8, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x47,
+  0x04, 0x80, 0x62, 0x00, 0x00, 0x05, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0xE0, 0x03, 0x82, 0x9D, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F,
+  0xC0, 0x09, 0x80, 0x00, 0xF4, 0x00, 0x21, 0x80, 0x00, 0x00, 0x64, 0x0A,
+  0x80, 0x00, 0x00, 0x9B, 0x04, 0x80, 0x3A, 0x00, 0x00, 0x06, 0x80, 0xFF,
+  0x00, 0x9B, 0x03, 0x80, 0xC5, 0x00, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x64,
+  0xC0, 0x09, 0x81, 0x00, 0xFF, 0x00, 0x00, 0x0D, 0x00, 0x20, 0x80, 0x00,
+  0x00, 0x15, 0x0A, 0x80, 0x00, 0x00, 0xEA, 0x04, 0x80, 0x15, 0x00, 0x00,
+  0x06, 0x80, 0xFF, 0x00, 0x5B, 0x03, 0x80, 0xEA, 0x00, 0xFF, 0x00, 0x80,
+  0x00, 0x00, 0xA4, 0xC0, 0x0A, 0x80, 0x00, 0x27, 0x00, 0x20, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xC2, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x3D, 0x03, 0x81, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x05, 0x80, 0xFF,
+  0x00, 0x16, 0x03, 0x82, 0xFF, 0x00, 0xFF, 0x12, 0x00, 0xFF, 0x00, 0x00,
+  0xE9, 0xC0, 0x0A, 0x80, 0x00, 0x40, 0x00, 0x21, 0x80, 0x00, 0x00, 0x6E,
+  0x0A, 0x80, 0x00, 0x00, 0x91, 0x04, 0x80, 0xC5, 0x00, 0x00, 0x05, 0x81,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xD1, 0x03, 0x82, 0x3A, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x2E, 0xC0, 0x0A, 0x80, 0x00, 0x58, 0x00, 0x21,
+  0x80, 0x00, 0x00, 0x1F, 0x0A, 0x80, 0x00, 0x00, 0xE0, 0x04, 0x80, 0xA0,
+  0x00, 0x00, 0x06, 0x80, 0xFF, 0x00, 0x91, 0x03, 0x80, 0x5F, 0x00, 0xFF,
+  0x00, 0x80, 0x00, 0x00, 0x6E, 0xC0, 0x0A, 0x80, 0x00, 0x71, 0x00, 0x21,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x09, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x33, 0x03, 0x80, 0x78, 0x00, 0x00, 0x06, 0x80, 0xFF, 0x00,
+  0x4C, 0x03, 0x80, 0x87, 0x00, 0xFF, 0x00, 0x80, 0x00, 0x00, 0xB3, 0xC0,
+  0x0A, 0x80, 0x00, 0x8B, 0x00, 0x22, 0x80, 0x00, 0x00, 0x78, 0x0A, 0x80,
+  0x00, 0x00, 0x87, 0x03, 0x80, 0x51, 0x00, 0x00, 0x06, 0x80, 0xFF, 0x00,
+  0x07, 0x03, 0x80, 0xAE, 0x00, 0xFF, 0x00, 0x80, 0x00, 0x00, 0xF8, 0xC0,
+  0x0A, 0x80, 0x00, 0xA3, 0x00, 0x22, 0x80, 0x00, 0x00, 0x2A, 0x0A, 0x80,
+  0x00, 0x00, 0xD5, 0x03, 0x80, 0x2B, 0x00, 0x00, 0x06, 0x81, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0xC7, 0x02, 0x80, 0xD4, 0x00, 0xFF, 0x00, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x38, 0xC0, 0x0A, 0x80, 0x00, 0xBC, 0x00, 0x22,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x09, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x29, 0x02, 0x80, 0x04, 0x00, 0x00, 0x07, 0x80, 0xFF, 0x00,
+  0x82, 0x02, 0x80, 0xFB, 0x00, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x7D, 0xC0,
+  0x0A, 0x80, 0x00, 0xD6, 0x00, 0x23, 0x80, 0x00, 0x00, 0x83, 0x0A, 0x80,
+  0x00, 0x00, 0x7C, 0x02, 0x81, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x06,
+  0x80, 0xFF, 0x00, 0x3D, 0x02, 0x81, 0xFF, 0x00, 0xFF, 0x24, 0x00, 0xFF,
+  0x00, 0x80, 0x00, 0x00, 0xC2, 0xC0, 0x0A, 0x80, 0x00, 0xEE, 0x00, 0x23,
+  0x80, 0x00, 0x00, 0x34, 0x0A, 0x80, 0x00, 0x00, 0xCB, 0x03, 0x80, 0xB6,
+  0x00, 0x00, 0x06, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x02, 0x80,
+  0x49, 0x00, 0xFF, 0x00, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xC0,
+  0x0A, 0x81, 0x00, 0xFF, 0x00, 0x00, 0x08, 0x00, 0x22, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xE0, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F,
+  0x02, 0x80, 0x8F, 0x00, 0x00, 0x07, 0x80, 0xFF, 0x00, 0xB8, 0x02, 0x80,
+  0x70, 0x00, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x47, 0xC0, 0x0B, 0x80, 0x00,
+  0x22, 0x00, 0x23, 0x80, 0x00, 0x00, 0x8D, 0x0A, 0x80, 0x00, 0x00, 0x72,
+  0x02, 0x80, 0x67, 0x00, 0x00, 0x07, 0x80, 0xFF, 0x00, 0x73, 0x02, 0x80,
+  0x98, 0x00, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x8C, 0xC0, 0x0B, 0x80, 0x00,
+  0x39, 0x00, 0x23, 0x80, 0x00, 0x00, 0x3E, 0x0A, 0x80, 0x00, 0x00, 0xC1,
+  0x02, 0x80, 0x42, 0x00, 0x00, 0x07, 0x80, 0xFF, 0x00, 0x33, 0x02, 0x80,
+  0xBD, 0x00, 0xFF, 0x01, 0x80, 0x00, 0x00, 0xCC, 0xC0, 0x0B, 0x80, 0x00,
+  0x53, 0x00, 0x23, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x09, 0x81,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x14, 0x01, 0x80, 0x1A, 0x00, 0x00, 0x07,
+  0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xEE, 0x01, 0x80, 0xE5, 0x00, 0xFF,
+  0x01, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x11, 0xC0, 0x0B, 0x80, 0x00,
+  0x6C, 0x00, 0x24, 0x80, 0x00, 0x00, 0x97, 0x0A, 0x80, 0x00, 0x00, 0x68,
+  0x01, 0x81, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x07, 0x80, 0xFF, 0x00,
+  0xA9, 0x01, 0x81, 0xFF, 0x00, 0xFF, 0x0D, 0x00, 0xFF, 0x01, 0x80, 0x00,
+  0x00, 0x56, 0xC0, 0x0B, 0x80, 0x00, 0x84, 0x00, 0x24, 0x80, 0x00, 0x00,
+  0x48, 0x0A, 0x80, 0x00, 0x00, 0xB7, 0x02, 0x80, 0xCD, 0x00, 0x00, 0x07,
+  0x80, 0xFF, 0x00, 0x69, 0x02, 0x80, 0x32, 0x00, 0xFF, 0x01, 0x80, 0x00,
+  0x00, 0x96, 0xC0, 0x0B, 0x80, 0x00, 0x9E, 0x00, 0x24, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF5, 0x09, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0A,
+  0x01, 0x80, 0xA5, 0x00, 0x00, 0x07, 0x80, 0xFF, 0x00, 0x24, 0x02, 0x80,
+  0x5A, 0x00, 0xFF, 0x01, 0x80, 0x00, 0x00, 0xDB, 0xC0, 0x0B, 0x80, 0x00,
+  0xB7, 0x00, 0x25, 0x80, 0x00, 0x00, 0xA1, 0x0A, 0x80, 0x00, 0x00, 0x5E,
+  0x01, 0x80, 0x7D, 0x00, 0x00, 0x07, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0xDF, 0x01, 0x80, 0x82, 0x00, 0xFF, 0x01, 0x81, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x20, 0xC0, 0x0B, 0x80, 0x00, 0xCF, 0x00, 0x25, 0x80, 0x00, 0x00,
+  0x53, 0x0A, 0x80, 0x00, 0x00, 0xAC, 0x01, 0x80, 0x58, 0x00, 0x00, 0x08,
+  0x80, 0xFF, 0x00, 0x9F, 0x01, 0x80, 0xA7, 0x00, 0xFF, 0x02, 0x80, 0x00,
+  0x00, 0x60, 0xC0, 0x0B, 0x80, 0x00, 0xE9, 0x00, 0x25, 0x80, 0x00, 0x00,
+  0x00, 0x0A, 0x80, 0x00, 0x00, 0xFF, 0x01, 0x80, 0x31, 0x00, 0x00, 0x08,
+  0x80, 0xFF, 0x00, 0x5A, 0x01, 0x80, 0xCE, 0x00, 0xFF, 0x02, 0x80, 0x00,
+  0x00, 0xA5, 0xC0, 0x0B, 0x81, 0x00, 0xFF, 0x00, 0x00, 0x03, 0x00, 0x25,
+  0x80, 0x00, 0x00, 0xAB, 0x0A, 0x80, 0x00, 0x00, 0x54, 0x00, 0x80, 0x09,
+  0x00, 0x00, 0x08, 0x80, 0xFF, 0x00, 0x15, 0x01, 0x80, 0xF6, 0x00, 0xFF,
+  0x02, 0x80, 0x00, 0x00, 0xEA, 0xC0, 0x0C, 0x80, 0x00, 0x1B, 0x00, 0x25,
+  0x80, 0x00, 0x00, 0x5D, 0x0A, 0x80, 0x00, 0x00, 0xA2, 0x00, 0x81, 0x00,
+  0x00, 0x00, 0xE3, 0x00, 0x00, 0x07, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0xD5, 0x00, 0x81, 0xFF, 0x00, 0xFF, 0x1C, 0x00, 0xFF, 0x01, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x2A, 0xC0, 0x0C, 0x80, 0x00, 0x34, 0x00, 0x25,
+  0x80, 0x00, 0x00, 0x09, 0x0A, 0x80, 0x00, 0x00, 0xF6, 0x01, 0x80, 0xBB,
+  0x00, 0x00, 0x08, 0x80, 0xFF, 0x00, 0x90, 0x01, 0x80, 0x44, 0x00, 0xFF,
+  0x02, 0x80, 0x00, 0x00, 0x6F, 0xC0, 0x0C, 0x80, 0x00, 0x4E, 0x00, 0x25,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x09, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x49, 0x00, 0x80, 0x94, 0x00, 0x00, 0x08, 0x80, 0xFF, 0x00,
+  0x4B, 0x01, 0x80, 0x6B, 0x00, 0xFF, 0x02, 0x80, 0x00, 0x00, 0xB4, 0xC0,
+  0x0C, 0x80, 0x00, 0x66, 0x00, 0x26, 0x80, 0x00, 0x00, 0x67, 0x0A, 0x80,
+  0x00, 0x00, 0x98, 0x00, 0x80, 0x6F, 0x00, 0x00, 0x08, 0x80, 0xFF, 0x00,
+  0x0B, 0x01, 0x80, 0x90, 0x00, 0xFF, 0x02, 0x80, 0x00, 0x00, 0xF4, 0xC0,
+  0x0C, 0x80, 0x00, 0x7F, 0x00, 0x26, 0x80, 0x00, 0x00, 0x13, 0x0A, 0x80,
+  0x00, 0x00, 0xEC, 0x00, 0x80, 0x47, 0x00, 0x00, 0x08, 0x81, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0xC6, 0x00, 0x80, 0xB8, 0x00, 0xFF, 0x02, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x39, 0xC0, 0x0C, 0x80, 0x00, 0x99, 0x00, 0x26,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x09, 0x82, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x09, 0x80, 0xFF, 0x00, 0x81, 0x00,
+  0x80, 0xDF, 0x00, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x7E, 0xC0, 0x0C, 0x80,
+  0x00, 0xB1, 0x00, 0x27, 0x80, 0x00, 0x00, 0x71, 0x0A, 0x82, 0x00, 0x00,
+  0x8E, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x08, 0x80, 0xFF, 0x00, 0x40,
+  0x00, 0x81, 0xFF, 0x00, 0xFF, 0x06, 0x00, 0xFF, 0x02, 0x80, 0x00, 0x00,
+  0xBF, 0xC0, 0x0C, 0x80, 0x00, 0xCA, 0x00, 0x27, 0x80, 0x00, 0x00, 0x1E,
+  0x0A, 0x80, 0x00, 0x00, 0xE1, 0x00, 0x80, 0xD2, 0x00, 0x00, 0x08, 0x81,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x80, 0x2D, 0x00, 0xFF, 0x02,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xC0, 0x0C, 0x80, 0x00, 0xE4,
+  0x00, 0x27, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0x09, 0x82, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x35, 0xAA, 0x00, 0x00, 0x09, 0x80, 0xFF, 0x00,
+  0xB7, 0x00, 0x80, 0x55, 0x00, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x48, 0xC0,
+  0x0C, 0x80, 0x00, 0xFC, 0x00, 0x28, 0x80, 0x00, 0x00, 0x7B, 0x0A, 0x81,
+  0x00, 0x00, 0x84, 0x85, 0x00, 0x00, 0x09, 0x80, 0xFF, 0x00, 0x76, 0x00,
+  0x80, 0x7A, 0x00, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x89, 0xC0, 0x0C, 0x81,
+  0x00, 0xFF, 0x00, 0x00, 0x16, 0x00, 0x27, 0x80, 0x00, 0x00, 0x28, 0x0A,
+  0x81, 0x00, 0x00, 0xD7, 0x5D, 0x00, 0x00, 0x09, 0x80, 0xFF, 0x00, 0x32,
+  0x00, 0x80, 0xA2, 0x00, 0xFF, 0x03, 0x80, 0x00, 0x00, 0xCD, 0xC0, 0x0D,
+  0x80, 0x00, 0x2F, 0x00, 0x27, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4,
+  0x09, 0x81, 0x00, 0x00, 0xFF, 0x36, 0x00, 0x2B, 0x09, 0x82, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0xED, 0xC9, 0x00, 0xFF, 0x03, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x12, 0xC0, 0x0D, 0x80, 0x00, 0x47, 0x00, 0x28, 0x80, 0x00,
+  0x00, 0x86, 0x0A, 0x80, 0x11, 0x00, 0x79, 0x0A, 0x81, 0xFF, 0x00, 0xAC,
+  0xEE, 0x00, 0xFF, 0x04, 0x80, 0x00, 0x00, 0x53, 0xC0, 0x0D, 0x80, 0x00,
+  0x61, 0x00, 0x28, 0x80, 0x00, 0x00, 0x32, 0x0A, 0x81, 0x00, 0x00, 0xCD,
+  0xE8, 0x00, 0x00, 0x09, 0x82, 0xFF, 0x00, 0x68, 0xFF, 0x00, 0xFF, 0x17,
+  0x00, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x97, 0xC0, 0x0D, 0x80, 0x00, 0x7A,
+  0x00, 0x28, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x09, 0x81, 0x00,
+  0x00, 0xFF, 0xC1, 0x00, 0x21, 0x09, 0x80, 0xFF, 0x00, 0x23, 0x00, 0x80,
+  0x3E, 0x00, 0xFF, 0x03, 0x80, 0x00, 0x00, 0xDC, 0xC0, 0x0D, 0x80, 0x00,
+  0x92, 0x00, 0x29, 0x80, 0x00, 0x00, 0x90, 0x0A, 0x80, 0x9B, 0x00, 0x6F,
+  0x09, 0x82, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xE2, 0x64, 0x00, 0xFF, 0x03,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1D, 0xC0, 0x0D, 0x80, 0x00, 0xAC,
+  0x00, 0x29, 0x80, 0x00, 0x00, 0x3C, 0x0A, 0x80, 0x74, 0x00, 0xC3, 0x0A,
+  0x81, 0xFF, 0x00, 0x9E, 0x8B, 0x00, 0xFF, 0x04, 0x80, 0x00, 0x00, 0x61,
+  0xC0, 0x0D, 0x80, 0x00, 0xC5, 0x00, 0x29, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xE9, 0x09, 0x81, 0x4C, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0x09, 0x81,
+  0xFF, 0x00, 0x59, 0xB3, 0x00, 0xFF, 0x04, 0x80, 0x00, 0x00, 0xA6, 0xC0,
+  0x0D, 0x80, 0x00, 0xDD, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x9A, 0x09, 0x81,
+  0x27, 0x00, 0xFF, 0xFF, 0x00, 0x65, 0x09, 0x81, 0xFF, 0x00, 0x18, 0xD8,
+  0x00, 0xFF, 0x04, 0x80, 0x00, 0x00, 0xE7, 0xC0, 0x0D, 0x80, 0x00, 0xF7,
+  0x00, 0x2A, 0x80, 0x00, 0x00, 0x46, 0x09, 0x81, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0xB9, 0x09, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xD4, 0x04, 0x81,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x2B, 0xC0, 0x80, 0x00, 0xEE, 0x00, 0x0C,
+  0x81, 0x00, 0xFF, 0x00, 0x00, 0x11, 0x00, 0x29, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF3, 0x09, 0x81, 0xD7, 0x00, 0xFF, 0xFF, 0x00, 0x0C, 0x09,
+  0x81, 0xFF, 0x00, 0x8F, 0x28, 0x00, 0xFF, 0x04, 0x80, 0x00, 0x00, 0x70,
+  0xC0, 0x80, 0x00, 0xD6, 0x00, 0x0D, 0x80, 0x00, 0x29, 0x00, 0x2A, 0x80,
+  0x00, 0x00, 0xA4, 0x09, 0x81, 0xB2, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x09,
+  0x81, 0xFF, 0x00, 0x4E, 0x4D, 0x00, 0xFF, 0x04, 0x80, 0x00, 0x00, 0xB1,
+  0xC0, 0x80, 0x00, 0xBD, 0x00, 0x0D, 0x80, 0x00, 0x42, 0x00, 0x2A, 0x80,
+  0x00, 0x00, 0x51, 0x09, 0x81, 0x8A, 0x00, 0xFF, 0xFF, 0x00, 0xAE, 0x09,
+  0x81, 0xFF, 0x00, 0x0A, 0x75, 0x00, 0xFF, 0x04, 0x80, 0x00, 0x00, 0xF5,
+  0xC0, 0x80, 0x00, 0xA3, 0x00, 0x0D, 0x80, 0x00, 0x5C, 0x00, 0x2A, 0x81,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x08, 0x82, 0x63, 0x00, 0xFF, 0xFF,
+  0x00, 0xFF, 0xFF, 0x00, 0x02, 0x08, 0x81, 0xFF, 0x00, 0x00, 0x9C, 0x00,
+  0xC5, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3A, 0xC0, 0x80, 0x00,
+  0x8B, 0x00, 0x0D, 0x80, 0x00, 0x74, 0x00, 0x2B, 0x80, 0x00, 0x00, 0xAE,
+  0x08, 0x80, 0x3D, 0x00, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x51, 0x09, 0x80,
+  0xC2, 0x00, 0x84, 0x05, 0x80, 0x00, 0x00, 0x7B, 0xC0, 0x80, 0x00, 0x72,
+  0x00, 0x0D, 0x80, 0x00, 0x8D, 0x00, 0x2B, 0x80, 0x00, 0x00, 0x5B, 0x08,
+  0x80, 0x16, 0x00, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0xA4, 0x09, 0x80, 0xE9,
+  0x00, 0x40, 0x05, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x80, 0x00, 0x58, 0x00,
+  0x0D, 0x80, 0x00, 0xA7, 0x00, 0x2B, 0x80, 0x00, 0x00, 0x07, 0x08, 0x82,
+  0x00, 0x00, 0xFF, 0xED, 0x00, 0xFF, 0xFF, 0x00, 0xF8, 0x09, 0x81, 0xFF,
+  0x00, 0x00, 0x12, 0x00, 0xFB, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x04, 0xC0, 0x80, 0x00, 0x40, 0x00, 0x0D, 0x80, 0x00, 0xBF, 0x00, 0x2B,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x08, 0x82, 0xC8, 0x00, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0x09, 0x80, 0x37, 0x00, 0xBA, 0x05,
+  0x80, 0x00, 0x00, 0x45, 0xC0, 0x80, 0x00, 0x27, 0x00, 0x0D, 0x80, 0x00,
+  0xD8, 0x00, 0x2C, 0x80, 0x00, 0x00, 0x65, 0x08, 0x80, 0xA1, 0x00, 0xFF,
+  0x00, 0x80, 0xFF, 0x00, 0x9A, 0x09, 0x80, 0x5E, 0x00, 0x76, 0x05, 0x80,
+  0x00, 0x00, 0x89, 0xC0, 0x80, 0x00, 0x0E, 0x00, 0x0D, 0x80, 0x00, 0xF1,
+  0x00, 0x2C, 0x80, 0x00, 0x00, 0x11, 0x08, 0x80, 0x79, 0x00, 0xFF, 0x00,
+  0x80, 0xFF, 0x00, 0xEE, 0x09, 0x80, 0x86, 0x00, 0x31, 0x05, 0x80, 0x00,
+  0x00, 0xCE, 0xC0, 0x81, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x0C, 0x81,
+  0x00, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x2B, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xC3, 0x07, 0x80, 0x54, 0x00, 0xFF, 0x00, 0x81, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0x3C, 0x08, 0x81, 0xAB, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x04,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x80, 0x00, 0xDB,
+  0x00, 0x0D, 0x80, 0x00, 0x24, 0x00, 0x2C, 0x80, 0x00, 0x00, 0x6F, 0x07,
+  0x80, 0x2C, 0x00, 0xFF, 0x01, 0x80, 0xFF, 0x00, 0x90, 0x08, 0x81, 0xD3,
+  0x00, 0x00, 0x00, 0x00, 0xAC, 0x05, 0x80, 0x00, 0x00, 0x53, 0xC0, 0x00,
+  0x80, 0x00, 0xC2, 0x00, 0x0D, 0x80, 0x00, 0x3D, 0x00, 0x2C, 0x80, 0x00,
+  0x00, 0x1C, 0x07, 0x80, 0x05, 0x00, 0xFF, 0x01, 0x80, 0xFF, 0x00, 0xE3,
+  0x08, 0x81, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x80, 0x00, 0x00,
+  0x98, 0xC0, 0x00, 0x80, 0x00, 0xAA, 0x00, 0x0D, 0x80, 0x00, 0x55, 0x00,
+  0x2C, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x06, 0x81, 0x00, 0x00,
+  0xFF, 0xDF, 0x00, 0xFF, 0x00, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x32,
+  0x07, 0x81, 0xFF, 0x00, 0x00, 0x20, 0x00, 0x26, 0x05, 0x80, 0x00, 0x00,
+  0xD9, 0xC0, 0x00, 0x80, 0x00, 0x90, 0x00, 0x0D, 0x80, 0x00, 0x6F, 0x00,
+  0x2D, 0x80, 0x00, 0x00, 0x79, 0x07, 0x80, 0xB7, 0x00, 0xFF, 0x01, 0x80,
+  0xFF, 0x00, 0x86, 0x08, 0x81, 0x48, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x04,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1D, 0xC0, 0x00, 0x80, 0x00, 0x77,
+  0x00, 0x0D, 0x80, 0x00, 0x88, 0x00, 0x2D, 0x80, 0x00, 0x00, 0x26, 0x07,
+  0x80, 0x8F, 0x00, 0xFF, 0x01, 0x80, 0xFF, 0x00, 0xD9, 0x08, 0x81, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x9D, 0x05, 0x80, 0x00, 0x00, 0x62, 0xC0, 0x00,
+  0x80, 0x00, 0x5F, 0x00, 0x0D, 0x80, 0x00, 0xA0, 0x00, 0x2D, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xD7, 0x06, 0x80, 0x6A, 0x00, 0xFF, 0x01, 0x81,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0x07, 0x81, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x5C, 0x05, 0x80, 0x00, 0x00, 0xA3, 0xC0, 0x00, 0x80, 0x00, 0x45,
+  0x00, 0x0D, 0x80, 0x00, 0xBA, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x84, 0x06,
+  0x80, 0x43, 0x00, 0xFF, 0x02, 0x80, 0xFF, 0x00, 0x7B, 0x07, 0x81, 0xBC,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x05, 0x80, 0x00, 0x00, 0xE7, 0xC0, 0x00,
+  0x80, 0x00, 0x2C, 0x00, 0x0D, 0x80, 0x00, 0xD3, 0x00, 0x2E, 0x80, 0x00,
+  0x00, 0x30, 0x06, 0x80, 0x1B, 0x00, 0xFF, 0x02, 0x80, 0xFF, 0x00, 0xCF,
+  0x07, 0x82, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x04,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2C, 0xC0, 0x00, 0x80, 0x00, 0x14,
+  0x00, 0x0D, 0x80, 0x00, 0xEB, 0x00, 0x2E, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xE1, 0x05, 0x81, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0xFF, 0x01, 0x81,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x1E, 0x06, 0x82, 0xFF, 0x00, 0x00, 0x0A,
+  0x00, 0x00, 0x00, 0x00, 0x92, 0x05, 0x80, 0x00, 0x00, 0x6D, 0xC0, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x0C, 0x81, 0x00, 0xFF, 0x00,
+  0x00, 0x05, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x8E, 0x06, 0x80, 0xCD, 0x00,
+  0xFF, 0x02, 0x80, 0xFF, 0x00, 0x71, 0x07, 0x81, 0x32, 0x00, 0x00, 0x00,
+  0x00, 0x4E, 0x05, 0x80, 0x00, 0x00, 0xB1, 0xC0, 0x01, 0x80, 0x00, 0xE0,
+  0x00, 0x0D, 0x80, 0x00, 0x1F, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x3A, 0x06,
+  0x80, 0xA6, 0x00, 0xFF, 0x02, 0x80, 0xFF, 0x00, 0xC5, 0x07, 0x81, 0x59,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x80, 0x00, 0x00, 0xF6, 0xC0, 0x01,
+  0x80, 0x00, 0xC8, 0x00, 0x0D, 0x80, 0x00, 0x37, 0x00, 0x2E, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xEC, 0x05, 0x80, 0x81, 0x00, 0xFF, 0x02, 0x81,
+  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x13, 0x06, 0x82, 0x7E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xC8, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x37, 0xC0, 0x01, 0x80, 0x00, 0xAF, 0x00, 0x0D, 0x80, 0x00, 0x50, 0x00,
+  0x2F, 0x80, 0x00, 0x00, 0x98, 0x05, 0x80, 0x59, 0x00, 0xFF, 0x03, 0x80,
+  0xFF, 0x00, 0x67, 0x06, 0x80, 0xA6, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x84, 0x05, 0x80, 0x00, 0x00, 0x7B, 0xC0, 0x80, 0x3B, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x95, 0x00, 0x0D, 0x80, 0x00, 0x6A, 0x00, 0x2F, 0x80, 0x00,
+  0x00, 0x44, 0x05, 0x80, 0x31, 0x00, 0xFF, 0x03, 0x80, 0xFF, 0x00, 0xBB,
+  0x06, 0x80, 0xCE, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3F, 0x05, 0x80,
+  0x00, 0x00, 0xC0, 0xC0, 0x80, 0x72, 0x00, 0x00, 0x00, 0x80, 0x00, 0x7D,
+  0x00, 0x0D, 0x80, 0x00, 0x82, 0x00, 0x2F, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF6, 0x04, 0x80, 0x0C, 0x00, 0xFF, 0x03, 0x81, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0x09, 0x05, 0x80, 0xF3, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFE, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
+  0xC0, 0x80, 0xAD, 0x00, 0x00, 0x00, 0x80, 0x00, 0x64, 0x00, 0x0D, 0x80,
+  0x00, 0x9B, 0x00, 0x30, 0x80, 0x00, 0x00, 0xA2, 0x04, 0x81, 0x00, 0x00,
+  0xFF, 0xE4, 0x00, 0xFF, 0x03, 0x80, 0xFF, 0x00, 0x5D, 0x05, 0x81, 0xFF,
+  0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xBA, 0x05, 0x80,
+  0x00, 0x00, 0x45, 0xC0, 0x80, 0xE8, 0x00, 0x00, 0x00, 0x80, 0x00, 0x4A,
+  0x00, 0x0D, 0x80, 0x00, 0xB5, 0x00, 0x30, 0x80, 0x00, 0x00, 0x4F, 0x05,
+  0x80, 0xBC, 0x00, 0xFF, 0x03, 0x80, 0xFF, 0x00, 0xB0, 0x06, 0x80, 0x43,
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x75, 0x05, 0x80, 0x00, 0x00, 0x8A,
+  0xC0, 0x82, 0xFF, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x33, 0x00, 0x0D,
+  0x80, 0x00, 0xCC, 0x00, 0x30, 0x80, 0x00, 0x00, 0x00, 0x05, 0x80, 0x97,
+  0x00, 0xFF, 0x03, 0x80, 0xFF, 0x00, 0xFF, 0x06, 0x80, 0x68, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x34, 0x05, 0x80, 0x00, 0x00, 0xCB, 0xC0, 0x00,
+  0x81, 0x5C, 0x00, 0x00, 0x00, 0x19, 0x00, 0x0D, 0x80, 0x00, 0xE6, 0x00,
+  0x31, 0x80, 0x00, 0x00, 0xAC, 0x04, 0x80, 0x6F, 0x00, 0xFF, 0x04, 0x80,
+  0xFF, 0x00, 0x53, 0x05, 0x80, 0x90, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF0, 0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
+  0xC0, 0x00, 0x81, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x80, 0x00,
+  0xFF, 0x00, 0x31, 0x80, 0x00, 0x00, 0x59, 0x04, 0x80, 0x48, 0x00, 0xFF,
+  0x04, 0x80, 0xFF, 0x00, 0xA6, 0x05, 0x80, 0xB7, 0x00, 0x00, 0x01, 0x80,
+  0x00, 0x00, 0xAB, 0x05, 0x80, 0x00, 0x00, 0x54, 0xC0, 0x00, 0x80, 0xCF,
+  0x00, 0x00, 0x00, 0x80, 0x00, 0xE7, 0x00, 0x0D, 0x80, 0x00, 0x18, 0x00,
+  0x30, 0x80, 0x00, 0x00, 0x0A, 0x04, 0x80, 0x23, 0x00, 0xFF, 0x04, 0x80,
+  0xFF, 0x00, 0xF5, 0x05, 0x80, 0xDC, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+  0x6A, 0x05, 0x80, 0x00, 0x00, 0x95, 0xC0, 0x00, 0x82, 0xFF, 0x00, 0x00,
+  0x0B, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x0D, 0x80, 0x00, 0x32, 0x00, 0x30,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x03, 0x81, 0x00, 0x00, 0xFF,
+  0xFA, 0x00, 0xFF, 0x03, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x48, 0x04,
+  0x81, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x26,
+  0x05, 0x80, 0x00, 0x00, 0xD9, 0xC0, 0x01, 0x81, 0x46, 0x00, 0x00, 0x00,
+  0xB4, 0x00, 0x0D, 0x80, 0x00, 0x4B, 0x00, 0x31, 0x80, 0x00, 0x00, 0x63,
+  0x04, 0x80, 0xD3, 0x00, 0xFF, 0x04, 0x80, 0xFF, 0x00, 0x9C, 0x05, 0x80,
+  0x2C, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x04,
+  0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0xC0, 0x01, 0x81, 0x7E, 0x00,
+  0x00, 0x00, 0x9C, 0x00, 0x0D, 0x80, 0x00, 0x63, 0x00, 0x31, 0x80, 0x00,
+  0x00, 0x14, 0x04, 0x80, 0xAD, 0x00, 0xFF, 0x04, 0x80, 0xFF, 0x00, 0xEB,
+  0x05, 0x80, 0x52, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xA0, 0x05, 0x80,
+  0x00, 0x00, 0x5F, 0xC0, 0x01, 0x81, 0xB9, 0x00, 0x00, 0x00, 0x82, 0x00,
+  0x0D, 0x80, 0x00, 0x7D, 0x00, 0x31, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC1, 0x03, 0x80, 0x86, 0x00, 0xFF, 0x04, 0x81, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0x3E, 0x04, 0x80, 0x79, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x5C,
+  0x05, 0x80, 0x00, 0x00, 0xA3, 0xC0, 0x01, 0x81, 0xF4, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x0D, 0x80, 0x00, 0x96, 0x00, 0x32, 0x80, 0x00, 0x00, 0x6D,
+  0x03, 0x80, 0x5E, 0x00, 0xFF, 0x05, 0x80, 0xFF, 0x00, 0x92, 0x04, 0x80,
+  0xA1, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x17, 0x05, 0x80, 0x00, 0x00,
+  0xE8, 0xC0, 0x01, 0x81, 0xFF, 0x00, 0x00, 0x2D, 0x51, 0x00, 0x0D, 0x80,
+  0x00, 0xAE, 0x00, 0x32, 0x80, 0x00, 0x00, 0x1F, 0x03, 0x80, 0x39, 0x00,
+  0xFF, 0x05, 0x80, 0xFF, 0x00, 0xE0, 0x04, 0x80, 0xC6, 0x00, 0x00, 0x01,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x04, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x29, 0xC0, 0x02, 0x80, 0x68, 0x38, 0x00, 0x0D, 0x80, 0x00,
+  0xC7, 0x00, 0x32, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x02, 0x80,
+  0x11, 0x00, 0xFF, 0x05, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x34, 0x03,
+  0x80, 0xEE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x92, 0x05, 0x80, 0x00,
+  0x00, 0x6D, 0xC0, 0x02, 0x80, 0xA3, 0x1E, 0x00, 0x0D, 0x80, 0x00, 0xE1,
+  0x00, 0x33, 0x80, 0x00, 0x00, 0x78, 0x02, 0x81, 0x00, 0x00, 0xFF, 0xE9,
+  0x00, 0xFF, 0x05, 0x80, 0xFF, 0x00, 0x87, 0x03, 0x81, 0xFF, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x4D, 0x05, 0x80, 0x00, 0x00,
+  0xB2, 0xC0, 0x02, 0x80, 0xDB, 0x06, 0x00, 0x0D, 0x80, 0x00, 0xF9, 0x00,
+  0x33, 0x80, 0x00, 0x00, 0x29, 0x03, 0x80, 0xC4, 0x00, 0xFF, 0x05, 0x80,
+  0xFF, 0x00, 0xD6, 0x04, 0x80, 0x3B, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+  0x0C, 0x05, 0x80, 0x00, 0x00, 0xF3, 0xC0, 0x02, 0x81, 0xFF, 0x00, 0x00,
+  0x17, 0xEC, 0x00, 0x0C, 0x81, 0x00, 0xFF, 0x00, 0x00, 0x13, 0x00, 0x32,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x02, 0x80, 0x9C, 0x00, 0xFF,
+  0x05, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x2A, 0x03, 0x80, 0x63, 0x00,
+  0x00, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x04, 0x81, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x37, 0xC0, 0x03, 0x80, 0x52, 0xD2, 0x00, 0x0D,
+  0x80, 0x00, 0x2D, 0x00, 0x33, 0x80, 0x00, 0x00, 0x82, 0x02, 0x80, 0x75,
+  0x00, 0xFF, 0x06, 0x80, 0xFF, 0x00, 0x7D, 0x03, 0x80, 0x8A, 0x00, 0x00,
+  0x02, 0x80, 0x00, 0x00, 0x83, 0x05, 0x80, 0x00, 0x00, 0x7C, 0xC0, 0x03,
+  0x80, 0x89, 0xBA, 0x00, 0x0D, 0x80, 0x00, 0x45, 0x00, 0x33, 0x80, 0x00,
+  0x00, 0x33, 0x02, 0x80, 0x4F, 0x00, 0xFF, 0x06, 0x80, 0xFF, 0x00, 0xCC,
+  0x03, 0x80, 0xB0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x42, 0x05, 0x80,
+  0x00, 0x00, 0xBD, 0xC0, 0x03, 0x80, 0xC5, 0xA1, 0x00, 0x0D, 0x80, 0x00,
+  0x5E, 0x00, 0x33, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x80,
+  0x28, 0x00, 0xFF, 0x06, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0x02,
+  0x80, 0xD7, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+  0x04, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xC0, 0x03, 0x81, 0xFF,
+  0x87, 0x00, 0x01, 0xFF, 0x00, 0x0C, 0x80, 0x00, 0x78, 0x00, 0x34, 0x80,
+  0x00, 0x00, 0x8C, 0x01, 0x80, 0x00, 0x00, 0xFF, 0x07, 0x80, 0xFF, 0x00,
+  0x73, 0x02, 0x80, 0xFF, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xB9, 0x05,
+  0x80, 0x00, 0x00, 0x46, 0xC0, 0x03, 0x81, 0xFF, 0x6F, 0x00, 0x38, 0xFF,
+  0x00, 0x0C, 0x80, 0x00, 0x90, 0x00, 0x34, 0x80, 0x00, 0x00, 0x3D, 0x02,
+  0x80, 0xDA, 0x00, 0xFF, 0x06, 0x80, 0xFF, 0x00, 0xC2, 0x03, 0x80, 0x25,
+  0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x78, 0x05, 0x80, 0x00, 0x00, 0x87,
+  0xC0, 0x03, 0x81, 0xFF, 0x56, 0x00, 0x73, 0xFF, 0x00, 0x0C, 0x80, 0x00,
+  0xA9, 0x00, 0x34, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x01, 0x80,
+  0xB3, 0x00, 0xFF, 0x06, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x15, 0x02,
+  0x80, 0x4C, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x33, 0x05, 0x80, 0x00,
+  0x00, 0xCC, 0xC0, 0x03, 0x81, 0xFF, 0x3D, 0x00, 0xAF, 0xFF, 0x00, 0x0C,
+  0x80, 0x00, 0xC2, 0x00, 0x35, 0x80, 0x00, 0x00, 0x96, 0x01, 0x80, 0x8B,
+  0x00, 0xFF, 0x07, 0x80, 0xFF, 0x00, 0x69, 0x02, 0x80, 0x74, 0x00, 0x00,
+  0x02, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x04, 0x81, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x10, 0xC0, 0x03, 0x81, 0xFF, 0x25, 0x00, 0xE6, 0xFF,
+  0x00, 0x0C, 0x80, 0x00, 0xDA, 0x00, 0x35, 0x80, 0x00, 0x00, 0x48, 0x01,
+  0x80, 0x66, 0x00, 0xFF, 0x07, 0x80, 0xFF, 0x00, 0xB7, 0x02, 0x80, 0x99,
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xAE, 0x05, 0x80, 0x00, 0x00, 0x51,
+  0xC0, 0x03, 0x82, 0xFF, 0x0B, 0x00, 0xFF, 0xFF, 0x00, 0x22, 0xFF, 0x00,
+  0x0B, 0x80, 0x00, 0xF4, 0x00, 0x35, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF4, 0x00, 0x80, 0x3E, 0x00, 0xFF, 0x07, 0x81, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0x0B, 0x01, 0x80, 0xC1, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x69,
+  0x05, 0x80, 0x00, 0x00, 0x96, 0xC0, 0x03, 0x82, 0xFF, 0x00, 0x00, 0xFF,
+  0xF1, 0x00, 0x5D, 0xFF, 0x00, 0x0B, 0x81, 0x00, 0xFF, 0x00, 0x00, 0x0E,
+  0x00, 0x35, 0x80, 0x00, 0x00, 0xA0, 0x00, 0x80, 0x17, 0x00, 0xFF, 0x08,
+  0x80, 0xFF, 0x00, 0x5F, 0x01, 0x80, 0xE8, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x25, 0x05, 0x80, 0x00, 0x00, 0xDA, 0xC0, 0x04, 0x81, 0xFF, 0xD9,
+  0x00, 0x95, 0xFF, 0x00, 0x0C, 0x80, 0x00, 0x26, 0x00, 0x35, 0x80, 0x00,
+  0x00, 0x52, 0x00, 0x81, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x07, 0x80,
+  0xFF, 0x00, 0xAD, 0x01, 0x81, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x04, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x1B, 0xC0, 0x04, 0x81, 0xFF, 0xBF, 0x00, 0xD0, 0xFF, 0x00,
+  0x0C, 0x80, 0x00, 0x40, 0x00, 0x35, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFE, 0x00, 0x80, 0xC9, 0x00, 0xFF, 0x07, 0x81, 0xFF, 0x00, 0xFF, 0xFF,
+  0x00, 0x01, 0x01, 0x80, 0x36, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x9F,
+  0x05, 0x80, 0x00, 0x00, 0x60, 0xC0, 0x80, 0xF3, 0x00, 0x00, 0x03, 0x82,
+  0xFF, 0xA6, 0x00, 0xFF, 0xFF, 0x00, 0x0C, 0xFF, 0x00, 0x0B, 0x80, 0x00,
+  0x59, 0x00, 0x36, 0x80, 0x00, 0x00, 0xAB, 0x00, 0x80, 0xA1, 0x00, 0xFF,
+  0x08, 0x80, 0xFF, 0x00, 0x54, 0x01, 0x80, 0x5E, 0x00, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x5B, 0x05, 0x80, 0x00, 0x00, 0xA4, 0xC0
+};
+
+extern const struct animation_s Line_Dance_Demo =
+{
+  "line_dance_demo",
+  150,
+  16666,
+  sizeof(Data),
+  Data
+};
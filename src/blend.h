@@ -0,0 +1,186 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  blend.h
+  Blend modes on packed 0x00RRGGBB colors, all channels at once. On the
+  Cortex-M4 the saturating and halving ones are single DSP instructions
+  (UQADD8, UQSUB8, UHADD8, USUB8 + SEL) working on the four bytes of a word
+  in parallel. Elsewhere they fall back to SWAR: the same per-byte math done
+  with masks and carries on a plain 32 bit integer. Neither version branches
+  on the channel values.
+
+  The span functions apply a mode along a run of pixels, either from another
+  run or from a single color. frameSpan() in frame.h hands out runs of the
+  render buffer to use them on.
+*/
+
+#ifndef BLEND_H
+#define BLEND_H
+
+#include <Arduino.h>
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#define BLEND_DSP 1
+#else
+#define BLEND_DSP 0
+#endif
+
+#define BLEND_HIGH_BITS 0x80808080
+#define BLEND_LOW_BITS  0x7F7F7F7F
+
+//Turns the top bit of each byte into a 0xFF or 0x00 byte
+static inline uint32_t blendByteMask(uint32_t high_bits)
+{
+  return (high_bits - (high_bits >> 7)) | high_bits;
+}
+
+//Each channel is a + b, held at 255
+static inline uint32_t blendAdd(uint32_t a, uint32_t b)
+{
+#if BLEND_DSP
+  uint32_t result;
+  asm("uqadd8 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+  return result;
+#else
+  uint32_t sum = ((a & BLEND_LOW_BITS) + (b & BLEND_LOW_BITS)) ^ ((a ^ b) & BLEND_HIGH_BITS);
+  uint32_t carry = ((a & b) | ((a | b) & ~sum)) & BLEND_HIGH_BITS;
+  return sum | blendByteMask(carry);
+#endif
+}
+
+//Each channel is a - b, held at 0
+static inline uint32_t blendSubtract(uint32_t a, uint32_t b)
+{
+#if BLEND_DSP
+  uint32_t result;
+  asm("uqsub8 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+  return result;
+#else
+  uint32_t difference = ((a | BLEND_HIGH_BITS) - (b & BLEND_LOW_BITS)) ^ ((a ^ ~b) & BLEND_HIGH_BITS);
+  uint32_t borrow = ((~a & b) | (~(a ^ b) & difference)) & BLEND_HIGH_BITS;
+  return difference & ~blendByteMask(borrow);
+#endif
+}
+
+//Each channel is the brighter of a and b
+static inline uint32_t blendMax(uint32_t a, uint32_t b)
+{
+#if BLEND_DSP
+  uint32_t result;
+  asm("usub8 %0, %1, %2\n\tsel %0, %1, %2" : "=&r" (result) : "r" (a), "r" (b) : "cc");
+  return result;
+#else
+  return b + blendSubtract(a, b); //Never carries between bytes: b + (a - b) is a
+#endif
+}
+
+//Each channel is the dimmer of a and b
+static inline uint32_t blendMin(uint32_t a, uint32_t b)
+{
+#if BLEND_DSP
+  uint32_t result;
+  asm("usub8 %0, %1, %2\n\tsel %0, %2, %1" : "=&r" (result) : "r" (a), "r" (b) : "cc");
+  return result;
+#else
+  return a - blendSubtract(a, b);
+#endif
+}
+
+//Each channel is the average of a and b, rounded down
+static inline uint32_t blendAverage(uint32_t a, uint32_t b)
+{
+#if BLEND_DSP
+  uint32_t result;
+  asm("uhadd8 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+  return result;
+#else
+  return (a & b) + (((a ^ b) & 0xFEFEFEFE) >> 1);
+#endif
+}
+
+//src laid over dst with an opacity of alpha / 256, from 0 (all dst) to 256 (all src)
+static inline uint32_t blendAlpha(uint32_t dst, uint32_t src, uint32_t alpha)
+{
+  uint32_t red_blue = (((src & 0xFF00FF) * alpha + (dst & 0xFF00FF) * (256 - alpha)) >> 8) & 0xFF00FF;
+  uint32_t green = (((src & 0x00FF00) * alpha + (dst & 0x00FF00) * (256 - alpha)) >> 8) & 0x00FF00;
+  return red_blue | green;
+}
+
+//a * b / 255 for one channel, rounded
+static inline uint32_t blendScaleChannel(uint32_t a, uint32_t b)
+{
+  uint32_t product = a * b + 128;
+  return (product + (product >> 8)) >> 8;
+}
+
+//Each channel is a * b / 255: white leaves a color as it is, black blacks it out
+static inline uint32_t blendMultiply(uint32_t a, uint32_t b)
+{
+  return (blendScaleChannel(a >> 16, b >> 16) << 16) |
+    (blendScaleChannel((a >> 8) & 0xFF, (b >> 8) & 0xFF) << 8) |
+    blendScaleChannel(a & 0xFF, b & 0xFF);
+}
+
+#define BLEND_SPAN(name, op) \
+  static inline void name##Span(uint32_t * dst, const uint32_t * src, int count) \
+  { \
+    for(int pixel = 0; pixel < count; pixel++) \
+    { \
+      dst[pixel] = op(dst[pixel], src[pixel]); \
+    } \
+  } \
+  static inline void name##Color(uint32_t * dst, uint32_t color, int count) \
+  { \
+    for(int pixel = 0; pixel < count; pixel++) \
+    { \
+      dst[pixel] = op(dst[pixel], color); \
+    } \
+  }
+
+//blendAddSpan(dst, src, count), blendAddColor(dst, color, count), and so on for each mode
+BLEND_SPAN(blendAdd, blendAdd)
+BLEND_SPAN(blendSubtract, blendSubtract)
+BLEND_SPAN(blendMax, blendMax)
+BLEND_SPAN(blendMin, blendMin)
+BLEND_SPAN(blendAverage, blendAverage)
+BLEND_SPAN(blendMultiply, blendMultiply)
+
+static inline void blendAlphaSpan(uint32_t * dst, const uint32_t * src, uint32_t alpha, int count)
+{
+  for(int pixel = 0; pixel < count; pixel++)
+  {
+    dst[pixel] = blendAlpha(dst[pixel], src[pixel], alpha);
+  }
+}
+
+static inline void blendAlphaColor(uint32_t * dst, uint32_t color, uint32_t alpha, int count)
+{
+  for(int pixel = 0; pixel < count; pixel++)
+  {
+    dst[pixel] = blendAlpha(dst[pixel], color, alpha);
+  }
+}
+
+#endif
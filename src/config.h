@@ -28,10 +28,85 @@ SOFTWARE.
   Contains basic configuration constants and a declaration of the OctoWS2811 object
 */
 
+#ifndef CONFIG_H
+#define CONFIG_H
+
 #include <OctoWS2811.h>
 
-//This shall be the length of the LED strand
-#define MAX_LEDS_PER_CHANNEL  150
+//This shall be the length of the LED strand, as the effects see it. This and
+//the other STRAND_ settings can also be given as build flags, so that each
+//installation gets its own platformio.ini environment (see strand.h).
+#ifndef STRAND_LENGTH
+#define STRAND_LENGTH  150
+#endif
+
+//The strand can be cut into segments that are each driven by their own
+//OctoWS2811 output, in output order (pin 2, 14, 7, 8, 6, 20, 21, 5). All
+//outputs are clocked out at the same time, so a frame takes as long to send
+//as the longest segment. Use 1 to 8 segments.
+#ifndef STRAND_SEGMENTS
+#define STRAND_SEGMENTS  1
+#endif
+
+//Bit N set means segment N is wired from its far end: its first LED on the
+//output is the last LED of that part of the strand.
+#ifndef STRAND_REVERSED_SEGMENTS
+#define STRAND_REVERSED_SEGMENTS  0x00
+#endif
+
+//How the strand is wrapped around the tree: the LEDs in each ring, from the
+//bottom up. The rings are stretched in proportion over longer strands.
+#define TREE_RING_SIZES  {26, 23, 21, 19, 17, 15, 12, 10, 7}
+
+//RAM, in bytes, the strand's buffers may take up between them: the render
+//targets, the transition mix, the dithering state and the DMA buffer. The
+//Teensy 3.2 has 64 KB; the rest is left for effects, USB and the stack.
+#define STRAND_RAM_BUDGET  (48 * 1024)
+
+//Gamma of the LEDs. Effects pick channel values on a perceptual scale and the
+//encode stage raises them to this power. 1.0 turns the correction off.
+#define GAMMA  2.2
+
+//Master brightness, 0 to 255, applied on top of the gamma correction. It can
+//be changed while running with frameSetBrightness().
+#define MASTER_BRIGHTNESS  255
+
+//Temporal dithering of the gamma corrected output, which smooths out the
+//dim end of fades. It is off by default for what it costs: with it on, the
+//whole strand is encoded and sent every frame, even when nothing was drawn,
+//instead of only the blocks that changed. Can be changed while running with
+//frameSetDither().
+#define DITHER  0
+
+//Supply budget for the strand, in milliamps. When a frame draws more than
+//this, the frames after it are dimmed to fit. 0 turns the limiter off.
+#define POWER_BUDGET_MA  10000
+
+//Current drawn by one color channel of one LED at full duty, and by each LED when dark
+#define LED_CHANNEL_MA  20
+#define LED_IDLE_MA     1
+
+//The rate at which frames are drawn and sent to the strand
+#define TARGET_FPS  60
+#define FRAME_PERIOD_US (1000000 / TARGET_FPS)
+
+//Effects are stepped in fixed increments of this many milliseconds, however
+//often frames are drawn. 0 steps them once per frame by that frame's time.
+#define UPDATE_PERIOD_MS  0
+
+//The most fixed steps taken in one frame. Time beyond that, after a stall, is dropped.
+#define UPDATE_MAX_STEPS  8
+
+//How one effect gives way to the next when the button is pressed. For
+//TRANSITION_MS milliseconds both are drawn, each into its own buffer, and
+//mixed: TRANSITION_CROSSFADE fades the whole strand over, TRANSITION_WIPE
+//sweeps the new effect in from the first LED, and TRANSITION_DISSOLVE
+//fades it in one LED at a time in a scattered order. 0 cuts straight over.
+#define TRANSITION_CROSSFADE  0
+#define TRANSITION_WIPE       1
+#define TRANSITION_DISSOLVE   2
+#define TRANSITION_MS     1000
+#define TRANSITION_STYLE  TRANSITION_CROSSFADE
 
 //If the LEDs use a different format for data or run on another data rate, specify that here
 #define OCTO_CONFIG (WS2811_RGB | WS2811_800kHz)
@@ -39,10 +114,17 @@ SOFTWARE.
 //The pin that the effect change button is tied to.
 #define PIN_BUTTON  22
 
+//How long the button has to hold a new level before it counts, in milliseconds. Contact bounce is shorter than this.
+#define BUTTON_DEBOUNCE_MS  20
+
 //The level shifter has a low-enable pin that must be used
 #define PIN_LEVEL_SHIFTER_EN  23
 
 //An analog read will be done from this pin to generate the random seed
+#ifndef PIN_RANDOM
 #define PIN_RANDOM  21
+#endif
 
 extern OctoWS2811 * Octo;
+
+#endif
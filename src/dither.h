@@ -0,0 +1,60 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  dither.h
+  Temporal dithering kernel used by the encode stage. A channel's gamma
+  corrected level is kept to 8 fractional bits (the Dither_Lut entry, level
+  << 8). Each frame the fraction left over from the previous frames is added
+  back in before the top 8 bits are sent, so a level of 4.25 goes out as
+  4, 4, 4, 5, ... and averages out to what was asked for. That keeps slow
+  fades and dim colors from stepping between the few levels the LEDs have
+  at the bottom of the range.
+*/
+
+#ifndef DITHER_H
+#define DITHER_H
+
+#include <Arduino.h>
+
+//Dither_Lut entries may not exceed this, so a residue can't carry a level past 255
+#define DITHER_LEVEL_MAX  (255 << 8)
+
+/*
+  Dithers one 0xRRGGBB color. lut maps channel values onto 8.8 fixed point
+  output levels and residue holds the pixel's red, green, and blue fractions,
+  which are updated.
+*/
+static inline uint32_t ditherColor(uint32_t color, const uint16_t * lut, uint8_t * residue)
+{
+  uint32_t red = lut[(color >> 16) & 0xFF] + residue[0];
+  uint32_t green = lut[(color >> 8) & 0xFF] + residue[1];
+  uint32_t blue = lut[color & 0xFF] + residue[2];
+  residue[0] = red;
+  residue[1] = green;
+  residue[2] = blue;
+  return ((red >> 8) << 16) | (green & 0xFF00) | (blue >> 8);
+}
+
+#endif
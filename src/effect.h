@@ -0,0 +1,74 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  effect.h
+  The interface every light effect implements. An effect is a const table of
+  the functions below, defined next to the effect and listed in the Effects
+  registry in main.cpp, so the registry is fixed at compile time and nothing
+  is allocated. All of an effect's state is private to its file.
+
+  Each frame the engine steps the active effect with update() and, only when
+  that reports a change, clears the frame and calls render(). Clearing
+  restores only the blocks the last render touched, from the background the
+  effect drew once when it became active, so render() only has to draw
+  what moves. Keeping the two
+  apart lets update() run at its own rate (UPDATE_PERIOD_MS) and lets frames
+  where nothing moved skip the clear, render, and encode work altogether.
+
+  An effect whose frames build on the last one can instead keep its pixels
+  in Frame, writing them in update() and marking them with
+  frameMarkChanged(), which frameClear() leaves alone.
+
+  An effect with a service() owns the serial input while it is active and
+  may write into Frame between frames. Its frames are only sent when
+  update() reports a change, never just to step the dithering or apply a
+  new brightness, since Frame may hold a partly written one in between.
+*/
+
+#ifndef EFFECT_H
+#define EFFECT_H
+
+#include <Arduino.h>
+
+struct effect_s
+{
+  const char *name;
+  void (* reset)(); // Returns the effect to its starting state. Called each time the effect becomes active
+  bool (* update)(uint32_t dt); // Advances the effect by dt milliseconds. Returns true if its next render would differ from the last
+  void (* render)(); // Draws the current state into the (already cleared) Frame. Must not change the state
+  void (* background)(uint32_t * layer); // Optional. Draws the parts that never move, once, into the layer frames are cleared to
+  void (* stress)(); // Optional. Spawns whatever the effect can hold right away, for benchmarking its heaviest load
+  void (* service)(); // Optional. Called on every loop() while the effect is active and no frame is waiting to be sent, for effects fed from outside
+};
+
+extern const struct effect_s LineDance;
+extern const struct effect_s CandyCane;
+extern const struct effect_s SerialStream;
+extern const struct effect_s Playback;
+
+extern const struct effect_s * const Effects[];
+extern const uint32_t EffectCount;
+
+#endif
@@ -0,0 +1,103 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  fixed.h
+  Q16.16 fixed point numbers for effect motion and intensity math. The
+  Teensy 3.2's Cortex-M4 has no FPU, so every float operation in a frame is a
+  call into the soft-float library; these are plain integer instructions.
+*/
+
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <stdint.h>
+
+typedef int32_t fixed_t;
+
+#define FIXED_SHIFT 16
+#define FIXED_ONE   ((fixed_t)1 << FIXED_SHIFT)
+#define FIXED_FRACTION_MASK (FIXED_ONE - 1)
+#define FIXED_MAX   ((fixed_t)0x7FFFFFFF)
+#define FIXED_MIN   ((fixed_t)-0x7FFFFFFF - 1)
+
+constexpr fixed_t intToFixed(int32_t value)
+{
+  return (fixed_t)((uint32_t)value << FIXED_SHIFT);
+}
+
+//Rounds towards negative infinity
+constexpr int32_t fixedToInt(fixed_t value)
+{
+  return value >> FIXED_SHIFT;
+}
+
+constexpr fixed_t fixedFraction(fixed_t value)
+{
+  return value & FIXED_FRACTION_MASK;
+}
+
+constexpr fixed_t fixedAbs(fixed_t value)
+{
+  return value < 0 ? (value == FIXED_MIN ? FIXED_MAX : -value) : value;
+}
+
+constexpr fixed_t fixedSaturate(int64_t value)
+{
+  return value > FIXED_MAX ? FIXED_MAX : (value < FIXED_MIN ? FIXED_MIN : (fixed_t)value);
+}
+
+constexpr fixed_t fixedAddSat(fixed_t a, fixed_t b)
+{
+  return fixedSaturate((int64_t)a + b);
+}
+
+constexpr fixed_t fixedSubSat(fixed_t a, fixed_t b)
+{
+  return fixedSaturate((int64_t)a - b);
+}
+
+//A single SMULL on the Cortex-M4
+constexpr fixed_t fixedMul(fixed_t a, fixed_t b)
+{
+  return (fixed_t)(((int64_t)a * b) >> FIXED_SHIFT);
+}
+
+constexpr fixed_t fixedMulSat(fixed_t a, fixed_t b)
+{
+  return fixedSaturate(((int64_t)a * b) >> FIXED_SHIFT);
+}
+
+constexpr fixed_t fixedClamp(fixed_t value, fixed_t low, fixed_t high)
+{
+  return value < low ? low : (value > high ? high : value);
+}
+
+//Converts a time step in milliseconds to seconds. Steps are capped at 65 seconds.
+constexpr fixed_t millisToFixedSeconds(uint32_t ms)
+{
+  return (fixed_t)(((ms < 0xFFFF ? ms : 0xFFFF) << FIXED_SHIFT) / 1000);
+}
+
+#endif
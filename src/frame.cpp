@@ -0,0 +1,447 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  frame.cpp
+  Render buffer storage and the encode pass into the OctoWS2811 layout.
+*/
+
+#include "frame.h"
+#include "dither.h"
+#include "gamma.h"
+
+struct frame_target_s
+{
+  uint32_t pixels[FRAME_PIXELS + 1];
+  uint32_t drawn[FRAME_BLOCK_WORDS];
+  uint32_t background[FRAME_PIXELS];
+};
+
+static struct frame_target_s Frame_Targets[FRAME_TARGETS];
+static uint32_t Frame_Mix[FRAME_PIXELS + 1]; // Written by whoever mixes the targets; the extra pixel stays black
+uint32_t *Frame = Frame_Targets[0].pixels;
+uint32_t *FrameDrawn = Frame_Targets[0].drawn;
+static uint32_t *Frame_Background = Frame_Targets[0].background;
+static const uint32_t *Frame_Output = Frame_Targets[0].pixels; // What frameEncode() sends
+struct frame_stats_s FrameStats;
+
+static uint32_t Frame_Cleared[FRAME_BLOCK_WORDS]; // Blocks blanked but not yet encoded
+static uint32_t Encode_Offsets[(Strand::leds_per_channel + 31) / 32]; // LED offsets frameEncode() has to convert
+
+/*
+  Output_Lut is Gamma_Table scaled by the master brightness, or less when the
+  power limiter asks for it, and cut down to the 8 bits the LEDs take.
+  Dither_Lut is the same with 8 fractional bits kept. Both are rebuilt by
+  frameEncode() whenever that brightness has changed since they were last
+  built.
+*/
+static uint8_t Output_Lut[256];
+static uint16_t Dither_Lut[256];
+static uint8_t Dither_Residue[FRAME_PIXELS + 1][3]; // Fraction of a level each LED's channels are owed
+static bool Dither = DITHER;
+static uint8_t Brightness = MASTER_BRIGHTNESS;
+static uint8_t Power_Limit = 255; // Brightness the power limiter allows
+static int16_t Lut_Brightness = -1; // Brightness Output_Lut was built for, -1 before the first build
+
+#if POWER_BUDGET_MA > 0
+#if POWER_BUDGET_MA <= STRAND_LENGTH * LED_IDLE_MA
+#error "POWER_BUDGET_MA doesn't cover the LEDs' idle current"
+#endif
+//Sum of all channel levels the budget leaves room for, on top of the idle current
+#define POWER_BUDGET_LEVELS ((uint32_t)(POWER_BUDGET_MA - STRAND_LENGTH * LED_IDLE_MA) * 255 / LED_CHANNEL_MA)
+static uint16_t Offset_Levels[Strand::leds_per_channel]; // Sum of the channel levels last encoded at each offset, over all strips
+static uint32_t Frame_Levels; // Sum of Offset_Levels
+#endif
+
+#define SEGMENT_TABLE(f) { f(0), f(1), f(2), f(3), f(4), f(5), f(6), f(7) }
+static const uint16_t Segment_Length[OCTO_STRIPS] = SEGMENT_TABLE(Strand::segmentLength);
+static const int32_t Segment_Origin[OCTO_STRIPS] = SEGMENT_TABLE(Strand::segmentOrigin);
+static const int8_t Segment_Step[OCTO_STRIPS] = SEGMENT_TABLE(Strand::segmentStep);
+
+//The DMA buffer lives in main.cpp, but grows with the strand the same way
+static_assert(sizeof(Frame_Targets) + sizeof(Frame_Mix) + sizeof(Frame_Cleared) + sizeof(Encode_Offsets) + sizeof(Dither_Residue)
+#if POWER_BUDGET_MA > 0
+  + sizeof(Offset_Levels)
+#endif
+  + Strand::framebuffer_words * sizeof(int) <= STRAND_RAM_BUDGET,
+  "The strand's buffers don't fit in STRAND_RAM_BUDGET; shorten the strand or raise the budget");
+
+void frameSetBackground(void (* draw)(uint32_t * layer))
+{
+  memset(Frame_Background, 0, FRAME_PIXELS * sizeof(Frame_Background[0]));
+  if(draw)
+  {
+    draw(Frame_Background);
+  }
+  memcpy(Frame, Frame_Background, FRAME_PIXELS * sizeof(Frame[0]));
+  memset(FrameDrawn, 0, FRAME_BLOCK_WORDS * sizeof(FrameDrawn[0]));
+  frameMarkAllDirty();
+}
+
+void frameSelectTarget(uint32_t target)
+{
+  Frame = Frame_Targets[target].pixels;
+  FrameDrawn = Frame_Targets[target].drawn;
+  Frame_Background = Frame_Targets[target].background;
+}
+
+uint32_t * frameTargetPixels(uint32_t target)
+{
+  return Frame_Targets[target].pixels;
+}
+
+void frameOutputTarget(uint32_t target)
+{
+  Frame_Output = Frame_Targets[target].pixels;
+  frameMarkAllDirty();
+}
+
+//Every pixel of a mix can change from one frame to the next, so it is all sent each time.
+uint32_t * frameOutputMix()
+{
+  Frame_Output = Frame_Mix;
+  frameMarkAllDirty();
+  return Frame_Mix;
+}
+
+void frameClear()
+{
+  uint32_t cleared = 0;
+  for(int word = 0; word < FRAME_BLOCK_WORDS; word++)
+  {
+    uint32_t blocks = FrameDrawn[word];
+    while(blocks)
+    {
+      uint32_t block = word * 32 + __builtin_ctz(blocks);
+      uint32_t first = block << FRAME_BLOCK_SHIFT;
+      uint32_t count = first + FRAME_BLOCK_SIZE <= FRAME_PIXELS ? FRAME_BLOCK_SIZE : FRAME_PIXELS - first;
+      memcpy(&Frame[first], &Frame_Background[first], count * sizeof(Frame[0]));
+      blocks &= blocks - 1;
+      cleared++;
+    }
+    Frame_Cleared[word] |= FrameDrawn[word];
+    FrameDrawn[word] = 0;
+  }
+  FrameStats.blocks_cleared = cleared;
+}
+
+static void markBlocks(uint32_t *mask, int first, int last)
+{
+  uint32_t block = (uint32_t)first >> FRAME_BLOCK_SHIFT;
+  uint32_t last_block = (uint32_t)last >> FRAME_BLOCK_SHIFT;
+  while(block <= last_block)
+  {
+    uint32_t bit = block & 31;
+    uint32_t count = last_block - block + 1 < 32 - bit ? last_block - block + 1 : 32 - bit;
+    mask[block >> 5] |= count == 32 ? 0xFFFFFFFF : ((1u << count) - 1) << bit;
+    block += count;
+  }
+}
+
+void frameMarkDrawn(int first, int last)
+{
+  markBlocks(FrameDrawn, first, last);
+}
+
+void frameMarkChanged(int first, int last)
+{
+  markBlocks(Frame_Cleared, first, last);
+}
+
+//Forces the next frameEncode() to convert the whole buffer.
+void frameMarkAllDirty()
+{
+  memset(Frame_Cleared, 0xFF, sizeof(Frame_Cleared));
+}
+
+static void markOffsets(uint32_t first, uint32_t last)
+{
+  while(first <= last)
+  {
+    uint32_t bit = first & 31;
+    uint32_t count = last - first + 1 < 32 - bit ? last - first + 1 : 32 - bit;
+    uint32_t mask = count == 32 ? 0xFFFFFFFF : ((1u << count) - 1) << bit;
+    Encode_Offsets[first >> 5] |= mask;
+    first += count;
+  }
+}
+
+/*
+  Marks the output offsets of a run of strand LEDs, which can span more than
+  one segment.
+*/
+static void markStrandRange(uint32_t first, uint32_t last)
+{
+  while(first <= last)
+  {
+    uint32_t segment = first / Strand::leds_per_channel;
+    uint32_t segment_start = segment * Strand::leds_per_channel;
+    uint32_t segment_last = segment_start + Segment_Length[segment] - 1;
+    uint32_t run_last = last < segment_last ? last : segment_last;
+    if(Strand::segmentReversed(segment))
+    {
+      markOffsets(segment_last - run_last, segment_last - first);
+    }
+    else
+    {
+      markOffsets(first - segment_start, run_last - segment_start);
+    }
+    first = run_last + 1;
+  }
+}
+
+//Turns the dirty blocks, which are in strand order, into the set of output offsets to encode.
+static void collectEncodeOffsets()
+{
+  for(int word = 0; word < FRAME_BLOCK_WORDS; word++)
+  {
+    uint32_t blocks = FrameDrawn[word] | Frame_Cleared[word];
+    while(blocks)
+    {
+      uint32_t block = word * 32 + __builtin_ctz(blocks);
+      blocks &= blocks - 1;
+      uint32_t first = block << FRAME_BLOCK_SHIFT;
+      if(first >= FRAME_PIXELS)
+      {
+        break;
+      }
+      uint32_t last = first + FRAME_BLOCK_SIZE - 1 < FRAME_PIXELS ? first + FRAME_BLOCK_SIZE - 1 : FRAME_PIXELS - 1;
+      markStrandRange(first, last);
+    }
+    Frame_Cleared[word] = 0;
+  }
+}
+
+void frameSetBrightness(uint8_t brightness)
+{
+  Brightness = brightness;
+}
+
+static inline uint8_t outputBrightness()
+{
+  return Brightness < Power_Limit ? Brightness : Power_Limit;
+}
+
+bool frameBrightnessPending()
+{
+  return Lut_Brightness != outputBrightness();
+}
+
+static inline uint8_t outputLevel(uint8_t value)
+{
+  return ((uint32_t)Gamma_Table[value] * outputBrightness() + 32767) / 65535;
+}
+
+static void buildOutputLut()
+{
+  if(Lut_Brightness < 0)
+  {
+    //Spread the residues out, so LEDs showing the same color don't all step up on the same frame
+    for(int led = 0; led < FRAME_PIXELS; led++)
+    {
+      for(int channel = 0; channel < 3; channel++)
+      {
+        Dither_Residue[led][channel] = (led * 3 + channel) * 167;
+      }
+    }
+  }
+  for(int value = 0; value < 256; value++)
+  {
+    Output_Lut[value] = outputLevel(value);
+    Dither_Lut[value] = ((uint32_t)Gamma_Table[value] * outputBrightness() << 8) / 65535; //At most DITHER_LEVEL_MAX
+  }
+  Lut_Brightness = outputBrightness();
+}
+
+void frameSetDither(bool dither)
+{
+  Dither = dither;
+  frameMarkAllDirty();
+}
+
+bool frameDither()
+{
+  return Dither;
+}
+
+static inline uint32_t correctColor(uint32_t color)
+{
+  return (Output_Lut[(color >> 16) & 0xFF] << 16) | (Output_Lut[(color >> 8) & 0xFF] << 8) | Output_Lut[color & 0xFF];
+}
+
+uint32_t frameOutputColor(uint32_t color)
+{
+  return (outputLevel(color >> 16) << 16) | (outputLevel(color >> 8) << 8) | outputLevel(color);
+}
+
+/*
+  Packs one color byte of all eight strips into two words, strip 7 in the
+  most significant byte of hi and strip 0 in the least significant byte of lo.
+*/
+#define PACK_STRIPS(c, shift, hi, lo) \
+  hi = (((c[7] >> (shift)) & 0xFF) << 24) | (((c[6] >> (shift)) & 0xFF) << 16) | \
+       (((c[5] >> (shift)) & 0xFF) << 8) | ((c[4] >> (shift)) & 0xFF); \
+  lo = (((c[3] >> (shift)) & 0xFF) << 24) | (((c[2] >> (shift)) & 0xFF) << 16) | \
+       (((c[1] >> (shift)) & 0xFF) << 8) | ((c[0] >> (shift)) & 0xFF)
+
+/*
+  Transposes the 8x8 bit matrix held in hi:lo (row 0 in the top byte of hi)
+  using the word-parallel swaps from Hacker's Delight, section 7-3. Afterwards
+  byte N, counting from the top of hi, holds bit 7 - N of every row, with row
+  0 (strip 7) in the most significant bit.
+*/
+static inline void transpose8x8(uint32_t &hi, uint32_t &lo)
+{
+  uint32_t t;
+
+  t = (hi ^ (hi >> 7)) & 0x00AA00AA; hi = hi ^ t ^ (t << 7);
+  t = (lo ^ (lo >> 7)) & 0x00AA00AA; lo = lo ^ t ^ (t << 7);
+  t = (hi ^ (hi >> 14)) & 0x0000CCCC; hi = hi ^ t ^ (t << 14);
+  t = (lo ^ (lo >> 14)) & 0x0000CCCC; lo = lo ^ t ^ (t << 14);
+  t = (hi & 0xF0F0F0F0) | ((lo >> 4) & 0x0F0F0F0F);
+  lo = ((hi << 4) & 0xF0F0F0F0) | (lo & 0x0F0F0F0F);
+  hi = t;
+}
+
+//Stores the top byte of a word first, whatever the CPU's byte order.
+static inline void storeBigEndian(uint32_t * out, uint32_t word)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  *out = __builtin_bswap32(word);
+#else
+  *out = word;
+#endif
+}
+
+/*
+  The DMA buffer holds 24 bytes per LED offset, one per color bit starting with
+  the most significant, and bit N of each byte is the level of strip N. Each
+  offset is one 8x8 bit transpose per color byte, so the buffer is written a
+  word at a time instead of one bit per strip at a time. Each channel goes
+  through Output_Lut, or the dithering kernel, on the way in. Offsets nothing was
+  drawn into or blanked at keep what the buffer already holds.
+*/
+static uint32_t encodeOffset(uint32_t * out, int offset)
+{
+  uint32_t colors[OCTO_STRIPS] = {0};
+  uint32_t levels = 0;
+  for(uint32_t strip = 0; strip < Strand::segments; strip++)
+  {
+    int led = offset < Segment_Length[strip] ? Segment_Origin[strip] + Segment_Step[strip] * offset : FRAME_PIXELS;
+    uint32_t color = Dither ? ditherColor(Frame_Output[led], Dither_Lut, Dither_Residue[led]) : correctColor(Frame_Output[led]);
+    colors[strip] = Strand::wireOrder(color);
+#if POWER_BUDGET_MA > 0
+    levels += (colors[strip] >> 16) + ((colors[strip] >> 8) & 0xFF) + (colors[strip] & 0xFF);
+#endif
+  }
+  for(int shift = 16; shift >= 0; shift -= 8)
+  {
+    uint32_t hi, lo;
+    PACK_STRIPS(colors, shift, hi, lo);
+    transpose8x8(hi, lo);
+    storeBigEndian(out++, hi);
+    storeBigEndian(out++, lo);
+  }
+  return levels;
+}
+
+/*
+  Works out the current of the frame just encoded and the brightness the next
+  ones may have. The levels scale in proportion to the brightness, so the
+  limit that brings them down to the budget is found without re-encoding
+  anything. It is only raised again once it has room to grow by a few steps,
+  so a frame sitting at the budget doesn't flip the table every frame.
+*/
+static void limitPower()
+{
+#if POWER_BUDGET_MA > 0
+  FrameStats.milliamps = (uint64_t)Frame_Levels * LED_CHANNEL_MA / 255 + STRAND_LENGTH * LED_IDLE_MA;
+  uint32_t allowed = Frame_Levels ? (uint64_t)Lut_Brightness * POWER_BUDGET_LEVELS / Frame_Levels : 255;
+  if(allowed > 255)
+  {
+    allowed = 255;
+  }
+  if(Frame_Levels > POWER_BUDGET_LEVELS || allowed >= (uint32_t)Power_Limit + 4 || allowed == 255)
+  {
+    Power_Limit = allowed;
+  }
+#else
+  FrameStats.milliamps = 0;
+#endif
+  FrameStats.power_limited = Lut_Brightness < Brightness;
+}
+
+void frameEncode(void * drawing_buffer)
+{
+  uint32_t blocks_drawn = 0;
+  for(int word = 0; word < FRAME_BLOCK_WORDS; word++)
+  {
+    blocks_drawn += __builtin_popcount(FrameDrawn[word]);
+  }
+  FrameStats.blocks_drawn = blocks_drawn;
+
+  if(frameBrightnessPending())
+  {
+    //Everything already sent was scaled for the old brightness
+    buildOutputLut();
+    frameMarkAllDirty();
+  }
+  collectEncodeOffsets();
+  if(Dither)
+  {
+    markOffsets(0, Strand::leds_per_channel - 1);
+  }
+  uint32_t encoded = 0;
+  for(uint32_t word = 0; word < (Strand::leds_per_channel + 31) / 32; word++)
+  {
+    uint32_t offsets = Encode_Offsets[word];
+    Encode_Offsets[word] = 0;
+    while(offsets)
+    {
+      int offset = word * 32 + __builtin_ctz(offsets);
+      offsets &= offsets - 1;
+      uint32_t levels = encodeOffset((uint32_t *)drawing_buffer + offset * 6, offset);
+#if POWER_BUDGET_MA > 0
+      Frame_Levels += levels - Offset_Levels[offset];
+      Offset_Levels[offset] = levels;
+#else
+      (void)levels;
+#endif
+      encoded++;
+    }
+  }
+  FrameStats.leds_encoded = encoded;
+  limitPower();
+}
+
+uint32_t framePhysicalIndex(int led)
+{
+  uint32_t segment = led / Strand::leds_per_channel;
+  uint32_t offset = led - segment * Strand::leds_per_channel;
+  if(Strand::segmentReversed(segment))
+  {
+    offset = Segment_Length[segment] - 1 - offset;
+  }
+  return segment * Strand::leds_per_channel + offset;
+}
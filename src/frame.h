@@ -0,0 +1,154 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  frame.h
+  The render buffer effects draw into. Pixels are stored as plain packed
+  0xRRGGBB words, one per LED along the whole strand (0 to STRAND_LENGTH - 1),
+  whichever output and direction each part of it is wired to. Once per frame
+  frameEncode() converts the buffer into the bit-planed layout the OctoWS2811
+  DMA reads from, mapping each LED onto its segment's output on the way.
+
+  Writes mark the FRAME_BLOCK_SIZE pixel block they land in. frameClear() only
+  blanks the blocks drawn into during the previous frame, back to the
+  background layer set with frameSetBackground() (black by default), and frameEncode()
+  only converts blocks that were drawn into or blanked since it last ran, so
+  the work per frame follows how much of the strand is lit rather than its length.
+
+  Gamma correction and the master brightness are applied by frameEncode(),
+  one table lookup per channel, so effects draw in plain perceptual values.
+  The encoder also keeps a running total of the channel levels sent, from
+  which it estimates the strand's current. When that is over POWER_BUDGET_MA
+  the next frames go out dimmer, through the same lookup table, so limiting
+  costs no extra pass over the buffer.
+
+  With dithering on, the lookup goes to 8 fractional bits instead, and each
+  LED keeps the fraction it couldn't show to add to its next frame (see
+  dither.h). Since the output then changes from frame to frame on its own,
+  every LED is encoded every frame.
+
+  There are FRAME_TARGETS render targets, each with its own pixels, drawn
+  blocks and background, so two effects can be drawn side by side during a
+  transition. Frame and FrameDrawn belong to the target selected with
+  frameSelectTarget(), and so do frameClear() and frameSetBackground().
+  frameEncode() sends the target picked with frameOutputTarget(), or the
+  separate mix buffer once frameOutputMix() has been called.
+*/
+
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "strand.h"
+
+#define FRAME_PIXELS ((int)Strand::leds)
+
+#define FRAME_BLOCK_SHIFT 3
+#define FRAME_BLOCK_SIZE  (1 << FRAME_BLOCK_SHIFT)
+#define FRAME_BLOCKS      ((FRAME_PIXELS + FRAME_BLOCK_SIZE - 1) >> FRAME_BLOCK_SHIFT)
+#define FRAME_BLOCK_WORDS ((FRAME_BLOCKS + 31) / 32)
+
+#define FRAME_TARGETS 2
+
+struct frame_stats_s
+{
+  uint32_t blocks_drawn; // Blocks written to during the last drawn frame
+  uint32_t blocks_cleared; // Blocks blanked at the start of the last drawn frame
+  uint32_t leds_encoded; // LED offsets converted by the last frameEncode(), each covering all strips
+  uint32_t milliamps; // Estimated current of the frame last encoded
+  bool power_limited; // The limiter sent that frame dimmer than the master brightness
+};
+
+extern uint32_t *Frame; // FRAME_PIXELS + 1 pixels. The extra pixel stays black; unused outputs are fed from it
+extern uint32_t *FrameDrawn; // One bit per block written since the last frameClear()
+extern struct frame_stats_s FrameStats;
+
+//Writes outside of the buffer are dropped, like they never reach a strip.
+inline void frameSetPixel(int led, uint32_t color)
+{
+  if((uint32_t)led < FRAME_PIXELS)
+  {
+    Frame[led] = color;
+    uint32_t block = (uint32_t)led >> FRAME_BLOCK_SHIFT;
+    FrameDrawn[block >> 5] |= 1u << (block & 31);
+  }
+}
+
+//Pixels outside of the buffer read back as black.
+inline uint32_t frameGetPixel(int led)
+{
+  return (uint32_t)led < FRAME_PIXELS ? Frame[led] : 0;
+}
+
+void frameMarkDrawn(int first, int last); // Marks the blocks of pixels first to last, already clipped to the strand
+void frameMarkChanged(int first, int last); // Like frameMarkDrawn(), but frameClear() leaves the pixels as they are
+
+/*
+  Hands out pixels first to last, clipped to the strand and marked as drawn,
+  for the span functions in blend.h to write to. Returns the first of them
+  and sets count to how many there are, which may be 0.
+*/
+inline uint32_t * frameSpan(int first, int last, int *count)
+{
+  if(first < 0)
+  {
+    first = 0;
+  }
+  if(last >= FRAME_PIXELS)
+  {
+    last = FRAME_PIXELS - 1;
+  }
+  if(last < first)
+  {
+    *count = 0;
+    return Frame;
+  }
+  *count = last - first + 1;
+  frameMarkDrawn(first, last);
+  return &Frame[first];
+}
+
+/*
+  Sets the static background every frame is cleared back to. draw is handed
+  the FRAME_PIXELS long layer, already black, to draw into; NULL leaves it
+  black. The whole strand is set to the new background right away.
+*/
+void frameSetBackground(void (* draw)(uint32_t * layer));
+void frameClear();
+void frameSelectTarget(uint32_t target); // Points Frame and the functions above at a render target
+uint32_t * frameTargetPixels(uint32_t target);
+void frameOutputTarget(uint32_t target); // Has frameEncode() send a target, whole the first time
+uint32_t * frameOutputMix(); // Has frameEncode() send the mix buffer, whole, and returns it to be written
+void frameMarkAllDirty();
+void frameEncode(void * drawing_buffer);
+uint32_t framePhysicalIndex(int led); // The OctoWS2811::setPixel() number of a strand LED
+
+void frameSetBrightness(uint8_t brightness); // Takes effect, on the whole strand, at the next frameEncode()
+bool frameBrightnessPending(); // A brightness change is waiting for frameEncode()
+uint32_t frameOutputColor(uint32_t color); // The gamma corrected, scaled 0xRRGGBB color frameEncode() sends for color, without dithering
+void frameSetDither(bool dither);
+bool frameDither(); // Dithering is on, so frames have to be sent even when nothing was drawn
+
+#endif
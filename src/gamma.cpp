@@ -0,0 +1,43 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  gamma.cpp
+  Storage for the gamma correction table.
+*/
+
+#include "gamma.h"
+
+#define GAMMA_ROW4(i)   gammaEntry(i), gammaEntry(i + 1), gammaEntry(i + 2), gammaEntry(i + 3)
+#define GAMMA_ROW16(i)  GAMMA_ROW4(i), GAMMA_ROW4(i + 4), GAMMA_ROW4(i + 8), GAMMA_ROW4(i + 12)
+#define GAMMA_ROW64(i)  GAMMA_ROW16(i), GAMMA_ROW16(i + 16), GAMMA_ROW16(i + 32), GAMMA_ROW16(i + 48)
+
+//Declared extern in gamma.h, so this is the one copy, in flash, and still usable in constant expressions here.
+constexpr uint16_t Gamma_Table[256] =
+{
+  GAMMA_ROW64(0), GAMMA_ROW64(64), GAMMA_ROW64(128), GAMMA_ROW64(192)
+};
+
+static_assert(Gamma_Table[0] == 0 && Gamma_Table[255] == 65535, "The gamma table must span the full duty range");
+static_assert(GAMMA != 1.0 || Gamma_Table[128] == 128 * 257, "A gamma of 1.0 must leave values unchanged");
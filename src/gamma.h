@@ -0,0 +1,79 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  gamma.h
+  Gamma correction table, worked out by the compiler. Effects pick colors on
+  a perceptual scale, where twice the value looks twice as bright; the LEDs
+  put out light in proportion to their PWM duty. Gamma_Table maps a channel
+  value onto the duty, with 16 bits of precision so the master brightness
+  can be applied afterwards without losing the dim end.
+
+  The math below only runs at compile time, so the board never does floating
+  point for it. It is written as single return statements to stay within
+  what C++11 allows in a constexpr function.
+*/
+
+#ifndef GAMMA_H
+#define GAMMA_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#define GAMMA_LN2 0.69314718055994530942
+
+//2 * atanh(z) = ln((1 + z) / (1 - z)), summed until the terms are far below double precision
+constexpr double gammaAtanhSeries(double z2, double power, int k)
+{
+  return k > 24 ? 0.0 : power / (2 * k + 1) + gammaAtanhSeries(z2, power * z2, k + 1);
+}
+
+//Natural log of x > 0. x is scaled into [0.5, 1) first so the series converges quickly.
+constexpr double gammaLn(double x, int exponent = 0)
+{
+  return x < 0.5 ? gammaLn(x * 2, exponent - 1) :
+    x >= 1.0 ? gammaLn(x / 2, exponent + 1) :
+    2 * gammaAtanhSeries(((x - 1) / (x + 1)) * ((x - 1) / (x + 1)), (x - 1) / (x + 1), 0) + exponent * GAMMA_LN2;
+}
+
+constexpr double gammaExpSeries(double x, double term, int k)
+{
+  return k > 24 ? 0.0 : term + gammaExpSeries(x, term * x / (k + 1), k + 1);
+}
+
+//e^x for x <= 0. Each ln(2) added to x halves the result, which keeps the series short.
+constexpr double gammaExp(double x)
+{
+  return x < -GAMMA_LN2 ? gammaExp(x + GAMMA_LN2) / 2 : gammaExpSeries(x, 1.0, 0);
+}
+
+//Duty, out of 65535, for channel value i
+constexpr uint16_t gammaEntry(int i)
+{
+  return i <= 0 ? 0 : i >= 255 ? 65535 : (uint16_t)(gammaExp(GAMMA * gammaLn(i / 255.0)) * 65535 + 0.5);
+}
+
+extern const uint16_t Gamma_Table[256];
+
+#endif
@@ -0,0 +1,119 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  input.cpp
+  The button interrupt, the event ring it fills, and the debouncing done
+  when loop() drains it. The ISR owns Input_Head and loop() owns
+  Input_Tail; each only reads the other's. An event is written before the
+  head moves past it and read before the tail does, with a compiler barrier
+  in between, which is all the ordering a single core needs.
+*/
+
+#include "config.h"
+#include "input.h"
+
+#define INPUT_BARRIER() __asm__ __volatile__("" ::: "memory")
+#define BUTTON_PRESSED LOW // The button pulls its pin low
+
+struct button_s
+{
+  uint8_t level; // The debounced level
+  uint8_t raw_level; // The level after the last edge
+  uint32_t raw_us; // When the last edge was seen
+};
+
+static struct input_event_s Input_Queue[INPUT_QUEUE_SIZE];
+static volatile uint32_t Input_Head = 0; // Next slot the ISR writes
+static volatile uint32_t Input_Tail = 0; // Next slot loop() reads
+static volatile bool Input_Overflow = false; // The ISR dropped an edge
+static struct button_s Button;
+struct input_stats_s InputStats;
+
+static void buttonChanged()
+{
+  uint32_t head = Input_Head;
+  if(head - Input_Tail >= INPUT_QUEUE_SIZE)
+  {
+    Input_Overflow = true;
+    return;
+  }
+  struct input_event_s *event = &Input_Queue[head & INPUT_QUEUE_MASK];
+  event->time_us = micros();
+  event->level = digitalRead(PIN_BUTTON);
+  INPUT_BARRIER();
+  Input_Head = head + 1;
+}
+
+void inputBegin()
+{
+  pinMode(PIN_BUTTON, INPUT);
+  Button.level = Button.raw_level = digitalRead(PIN_BUTTON);
+  Button.raw_us = micros();
+  attachInterrupt(digitalPinToInterrupt(PIN_BUTTON), buttonChanged, CHANGE);
+}
+
+//Takes on the last edge's level if it held until time_us. Returns 1 if that pressed the button.
+static uint32_t settleButton(uint32_t time_us)
+{
+  if(Button.raw_level == Button.level || time_us - Button.raw_us < BUTTON_DEBOUNCE_MS * 1000)
+  {
+    return 0;
+  }
+  Button.level = Button.raw_level;
+  return Button.level == BUTTON_PRESSED;
+}
+
+static void bounceButton(uint8_t level, uint32_t time_us)
+{
+  Button.raw_level = level;
+  Button.raw_us = time_us;
+}
+
+uint32_t inputPresses(uint32_t now_us)
+{
+  uint32_t presses = 0;
+  uint32_t tail = Input_Tail;
+  while(tail != Input_Head)
+  {
+    INPUT_BARRIER();
+    struct input_event_s event = Input_Queue[tail & INPUT_QUEUE_MASK];
+    INPUT_BARRIER();
+    Input_Tail = ++tail;
+    presses += settleButton(event.time_us);
+    bounceButton(event.level, event.time_us);
+    InputStats.edges++;
+  }
+  //Edges were lost, so the last level seen may be stale. The pin says what it is now, and has to hold that from here.
+  if(Input_Overflow)
+  {
+    Input_Overflow = false;
+    presses += settleButton(now_us);
+    bounceButton(digitalRead(PIN_BUTTON), now_us);
+    InputStats.overflows++;
+  }
+  presses += settleButton(now_us);
+  InputStats.presses += presses;
+  return presses;
+}
@@ -0,0 +1,61 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  input.h
+  The effect change button. Its interrupt only timestamps each edge into a
+  single-producer/single-consumer ring; loop() drains the ring between
+  frames and debounces the edges by their timestamps. A press that is
+  counted there is one whose new level held for BUTTON_DEBOUNCE_MS, so the
+  bouncing of the contacts, on press and on release, is never counted and
+  the ISR never waits.
+*/
+
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <Arduino.h>
+
+#define INPUT_QUEUE_SIZE 32 //Edges the ring holds between two frames. Must be a power of two
+#define INPUT_QUEUE_MASK (INPUT_QUEUE_SIZE - 1)
+
+struct input_event_s
+{
+  uint32_t time_us; // micros() when the edge was seen
+  uint8_t level; // The button pin's level right after it
+};
+
+struct input_stats_s
+{
+  uint32_t edges; // Edges taken off the ring
+  uint32_t presses; // Edges left after debouncing that pressed the button
+  uint32_t overflows; // Times the ring was full and the pin had to be read again
+};
+
+extern struct input_stats_s InputStats;
+
+void inputBegin(); // Attaches the button interrupt
+uint32_t inputPresses(uint32_t now_us); // Drains the ring. Returns the debounced presses since the last call
+
+#endif
@@ -31,73 +31,286 @@ SOFTWARE.
 #include <Arduino.h>
 #include <OctoWS2811.h>
 #include "config.h"
+#include "effect.h"
+#include "frame.h"
+#include "input.h"
+#include "rng.h"
+#include "strand.h"
+#include "telemetry.h"
+#include "transition.h"
+#include "wire_timing.h"
 
-#define OCTO_FRAMEBUFFER_SIZE (MAX_LEDS_PER_CHANNEL * 6)
-#define OCTO_DRAWINGBUFFER_SIZE (MAX_LEDS_PER_CHANNEL * 6)
+#if STRAND_SEGMENTS >= 7 && PIN_RANDOM == 21
+#error "Pin 21 is OctoWS2811 output 7; move PIN_RANDOM to drive 7 or more segments"
+#endif
 
+static_assert(wireFrameUs(Strand::leds_per_channel, Strand::config) <= FRAME_PERIOD_US,
+  "A segment this long can't be sent TARGET_FPS times a second; add segments or lower TARGET_FPS (see the native build's timing command)");
+
+/*
+  OctoWS2811 is given a single buffer: the DMA reads FrameBuffer directly and
+  there is no drawing buffer to copy from in show(). Effects draw into the
+  linear Frame instead, which isn't touched by the DMA, so the next frame can
+  be drawn while the current one is being clocked out. FrameBuffer is only
+  rewritten by frameEncode() once the transfer has finished.
+*/
 OctoWS2811 * Octo;
-int FrameBuffer[OCTO_FRAMEBUFFER_SIZE];
-int DrawingBuffer[OCTO_DRAWINGBUFFER_SIZE];
+int FrameBuffer[Strand::framebuffer_words];
+bool FramePending = false; // A drawn frame is waiting in Frame for the DMA to free up
 
 /*
-  List drawing function declarations to be listed in DrawRoutines
+  The effect registry. Effects are cycled through in this order by the
+  button; an effect that isn't listed here is never run.
 */
-void drawLineDance();
-void drawCandyCane();
+const struct effect_s * const Effects[] =
+{
+  &LineDance,
+  &CandyCane,
+  &Playback,
+  &SerialStream
+};
+extern const uint32_t EffectCount = sizeof(Effects) / sizeof(Effects[0]);
+
+#define NO_EFFECT 0xFFFFFFFF
+
+uint32_t CurrentEffect = 0; // The effect picked with the button, moved on by loop() between frames
+uint32_t ActiveEffect = NO_EFFECT; // The effect whose state is live. Set to CurrentEffect, after a reset(), at the start of a frame
+uint32_t ActiveTarget = 0; // The render target ActiveEffect draws into. An outgoing effect has the other one
 
 /*
-  This function pointer list determines the order at which drawing
-  routines are cycled through. If a drawing routine is not added to
-  this list, it will not be called.
+  While an effect is fading out it keeps being updated and drawn, into its
+  own target, and both targets are mixed into the frame sent.
 */
-uint32_t CurrentDrawingRoutine = 0;
-void (* DrawRoutines[])() =
+struct transition_s
 {
-  drawLineDance,
-  drawCandyCane
+  uint32_t from; // The outgoing effect, or NO_EFFECT
+  uint32_t elapsed_ms;
 };
 
+struct transition_s Transition = {NO_EFFECT, 0};
+
+struct frame_clock_s
+{
+  uint32_t deadline; // micros() value at which the next frame is due
+  uint32_t pending_us; // Scheduled time not yet handed to an effect as whole milliseconds
+  uint32_t update_ms[FRAME_TARGETS]; // Time handed to each target's effect that doesn't yet add up to a whole UPDATE_PERIOD_MS step
+  uint32_t frame_count;
+  uint32_t missed_frames; // Deadlines skipped because a frame ran past them
+};
+
+struct frame_clock_s FrameClock;
+
 void enableLevelShifter();
-void setupButton();
+void startEffect(uint32_t effect_index);
+bool updateEffect(const struct effect_s *effect, uint32_t dt, uint32_t *update_ms);
+void drawEffect(const struct effect_s *effect);
+void mixTransition(uint32_t dt);
+void sendPendingFrame();
 
 void setup()
 {
-  memset(DrawingBuffer, 0, sizeof(DrawingBuffer));
   memset(FrameBuffer, 0, sizeof(FrameBuffer));
-  Octo = new OctoWS2811(MAX_LEDS_PER_CHANNEL, FrameBuffer, DrawingBuffer, OCTO_CONFIG);
+  Octo = new OctoWS2811(Strand::leds_per_channel, FrameBuffer, NULL, Strand::config);
   Octo->begin();
   enableLevelShifter();
-  setupButton();
+  inputBegin();
   pinMode(PIN_RANDOM, INPUT);
-  randomSeed(analogRead(PIN_RANDOM));
+  rngBegin(analogRead(PIN_RANDOM));
+  telemetryBegin();
+  FrameClock.deadline = micros();
 }
 
+/*
+  Frames are drawn at TARGET_FPS. Until the next deadline loop() returns
+  right away, leaving the time between frames free for other work. A drawn
+  frame is sent as soon as the previous transfer (and the strand's reset
+  time) is over; drawing the next one doesn't wait for that. Frames on which
+  the effect reports no change aren't drawn, and unless the brightness
+  changed or dithering is on, aren't sent either; the strand keeps showing
+  the last one.
+
+  An effect fed from outside gets to read its input on every call, except
+  while a frame waits to be sent, as that frame is still in Frame. Button
+  presses are only taken in as a frame starts, so the effect can't change
+  under one.
+*/
 void loop()
 {
-  for(int led = 0; led < MAX_LEDS_PER_CHANNEL; led++)
+  sendPendingFrame();
+  const struct effect_s *active = ActiveEffect < EffectCount ? Effects[ActiveEffect] : NULL;
+  if(active && active->service)
   {
-    Octo->setPixel(led, 0);
+    if(!FramePending)
+    {
+      active->service();
+    }
   }
-  DrawRoutines[CurrentDrawingRoutine]();
-  Octo->show();
+  else
+  {
+    telemetryReadCommands();
+  }
+  telemetryService();
+
+  uint32_t now = micros();
+  if(FramePending || (int32_t)(now - FrameClock.deadline) < 0)
+  {
+    return;
+  }
+
+  //If frames overran, skip the deadlines they missed and let this frame cover the whole gap.
+  uint32_t late_frames = (now - FrameClock.deadline) / FRAME_PERIOD_US;
+  FrameClock.missed_frames += late_frames;
+  FrameClock.deadline += (late_frames + 1) * FRAME_PERIOD_US;
+  FrameClock.pending_us += (late_frames + 1) * FRAME_PERIOD_US;
+  uint32_t dt = FrameClock.pending_us / 1000;
+  FrameClock.pending_us %= 1000;
+  FrameClock.frame_count++;
+
+  CurrentEffect = (CurrentEffect + inputPresses(now)) % EffectCount;
+  uint32_t effect_index = CurrentEffect;
+  const struct effect_s *effect = Effects[effect_index];
+  telemetryBeginFrame(FrameClock.frame_count, effect_index);
+  bool changed = false;
+  if(effect_index != ActiveEffect)
+  {
+    startEffect(effect_index);
+    changed = true;
+  }
+  changed |= updateEffect(effect, dt, &FrameClock.update_ms[ActiveTarget]);
+  bool fading = Transition.from != NO_EFFECT;
+  bool fading_changed = false;
+  if(fading)
+  {
+    //Effects can write Frame from update() too, so the outgoing one gets its own target for both
+    frameSelectTarget(ActiveTarget ^ 1);
+    fading_changed = updateEffect(Effects[Transition.from], dt, &FrameClock.update_ms[ActiveTarget ^ 1]);
+  }
+  telemetryLap(TELEMETRY_UPDATE);
+  if(fading_changed)
+  {
+    drawEffect(Effects[Transition.from]);
+  }
+  frameSelectTarget(ActiveTarget);
+  if(changed)
+  {
+    drawEffect(effect);
+  }
+  if(fading)
+  {
+    mixTransition(dt);
+    telemetryLap(TELEMETRY_RENDER);
+  }
+  else if(!changed && (effect->service || (!frameBrightnessPending() && !frameDither())))
+  {
+    telemetryEndFrame();
+    return;
+  }
+  //A new brightness or the next dithering step still has to be sent, from the last frame drawn, which Frame holds until the next clear
+  FramePending = true;
+  sendPendingFrame();
 }
 
-void changeDraw()
+/*
+  Makes a newly picked effect the active one. It starts over from its first
+  step, rather than from wherever it was left, in the target the effect
+  before it wasn't using, so that one can fade out alongside it. Switching
+  to or from an effect fed from outside cuts over at once, as its target can
+  hold a partly read frame that can't be mixed.
+*/
+void startEffect(uint32_t effect_index)
 {
-  if(++CurrentDrawingRoutine >= sizeof(DrawRoutines) / sizeof(DrawRoutines[0]))
+  const struct effect_s *effect = Effects[effect_index];
+  if(TRANSITION_MS > 0 && ActiveEffect != NO_EFFECT && !effect->service && !Effects[ActiveEffect]->service)
   {
-    CurrentDrawingRoutine = 0;
+    Transition.from = ActiveEffect;
+    Transition.elapsed_ms = 0;
+    ActiveTarget ^= 1;
   }
+  else if(Transition.from != NO_EFFECT)
+  {
+    Transition.from = NO_EFFECT;
+  }
+  frameSelectTarget(ActiveTarget);
+  effect->reset();
+  frameSetBackground(effect->background);
+  frameOutputTarget(ActiveTarget);
+  ActiveEffect = effect_index;
+  FrameClock.update_ms[ActiveTarget] = 0;
 }
 
-void enableLevelShifter()
+void drawEffect(const struct effect_s *effect)
 {
-  pinMode(PIN_LEVEL_SHIFTER_EN, OUTPUT);
-  digitalWrite(PIN_LEVEL_SHIFTER_EN, 0);
+  frameClear();
+  telemetryLap(TELEMETRY_CLEAR);
+  effect->render();
+  telemetryLap(TELEMETRY_RENDER);
+}
+
+//Advances the transition by dt and mixes the two targets, or sends the active one alone once it is over.
+void mixTransition(uint32_t dt)
+{
+  Transition.elapsed_ms += dt;
+  if(Transition.elapsed_ms >= TRANSITION_MS)
+  {
+    Transition.from = NO_EFFECT;
+    frameOutputTarget(ActiveTarget);
+    return;
+  }
+  uint32_t progress = ((uint64_t)Transition.elapsed_ms << TRANSITION_PROGRESS_SHIFT) / TRANSITION_MS;
+  transitionMix(TRANSITION_STYLE, frameOutputMix(), frameTargetPixels(ActiveTarget ^ 1), frameTargetPixels(ActiveTarget), progress);
+}
+
+/*
+  Hands dt milliseconds to the effect, either as is or as whole
+  UPDATE_PERIOD_MS steps with the remainder carried to the next frame in update_ms.
+  Returns true if any step changed what the effect would render.
+*/
+bool updateEffect(const struct effect_s *effect, uint32_t dt, uint32_t *update_ms)
+{
+#if UPDATE_PERIOD_MS > 0
+  bool changed = false;
+  uint32_t steps = 0;
+  *update_ms += dt;
+  while(*update_ms >= UPDATE_PERIOD_MS)
+  {
+    if(++steps > UPDATE_MAX_STEPS)
+    {
+      *update_ms %= UPDATE_PERIOD_MS;
+      break;
+    }
+    changed |= effect->update(UPDATE_PERIOD_MS);
+    *update_ms -= UPDATE_PERIOD_MS;
+  }
+  return changed;
+#else
+  (void)update_ms;
+  return effect->update(dt);
+#endif
+}
+
+/*
+  busy() stays set until the DMA completion interrupt has fired and the
+  strand has latched, which is the point FrameBuffer is free to rewrite.
+  show() then has nothing to wait for and no buffer to copy.
+*/
+void sendPendingFrame()
+{
+  if(!FramePending || Octo->busy())
+  {
+    return;
+  }
+  telemetryLap(TELEMETRY_WAIT);
+  frameEncode(FrameBuffer);
+  telemetryLap(TELEMETRY_ENCODE);
+  telemetryPower(FrameStats.milliamps, FrameStats.power_limited);
+  Octo->show();
+  telemetryLap(TELEMETRY_SHOW);
+  telemetryEndFrame();
+  FramePending = false;
 }
 
-void setupButton()
+void enableLevelShifter()
 {
-  pinMode(PIN_BUTTON, INPUT);
-  attachInterrupt(digitalPinToInterrupt(PIN_BUTTON), changeDraw, FALLING);
+  pinMode(PIN_LEVEL_SHIFTER_EN, OUTPUT);
+  digitalWrite(PIN_LEVEL_SHIFTER_EN, 0);
 }
@@ -0,0 +1,126 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  particle_pool.h
+  Slot bookkeeping for effects with a fixed number of particles. The pool
+  only hands out slot numbers; the effect keeps each particle field in its
+  own Capacity long array indexed by slot (structure of arrays), so a pass
+  that only needs positions only touches positions.
+
+  Free slots sit on a stack, so spawning and freeing are O(1). Live slots are
+  kept packed at the front of a second array, so updates and renders visit
+  live particles only, whatever the capacity. A dead particle is removed by
+  moving the last live one into its place, which changes the visiting order;
+  loops that free as they go must not advance past the index they freed:
+
+    for(uint16_t index = 0; index < Pool.count();)
+    {
+      uint16_t slot = Pool.slot(index);
+      if(dead(slot))
+      {
+        Pool.free(index);
+        continue;
+      }
+      index++;
+    }
+*/
+
+#ifndef PARTICLE_POOL_H
+#define PARTICLE_POOL_H
+
+#include <Arduino.h>
+
+#define PARTICLE_POOL_NONE 0xFFFF
+
+template <uint16_t Capacity>
+class ParticlePool
+{
+  static_assert(Capacity > 0 && Capacity < PARTICLE_POOL_NONE, "A particle pool holds 1 to 65534 particles");
+
+public:
+  ParticlePool()
+  {
+    clear();
+  }
+
+  //Frees every particle.
+  void clear()
+  {
+    live_count = 0;
+    free_count = Capacity;
+    for(uint16_t slot = 0; slot < Capacity; slot++)
+    {
+      free_slots[slot] = Capacity - 1 - slot; //Slot 0 is handed out first
+    }
+  }
+
+  //Takes a free slot and returns it, or PARTICLE_POOL_NONE if the pool is full.
+  uint16_t spawn()
+  {
+    if(free_count == 0)
+    {
+      return PARTICLE_POOL_NONE;
+    }
+    uint16_t slot = free_slots[--free_count];
+    live_slots[live_count++] = slot;
+    return slot;
+  }
+
+  //Frees the index-th live particle. The last live particle takes over that index.
+  void free(uint16_t index)
+  {
+    free_slots[free_count++] = live_slots[index];
+    live_slots[index] = live_slots[--live_count];
+  }
+
+  uint16_t count() const
+  {
+    return live_count;
+  }
+
+  bool full() const
+  {
+    return free_count == 0;
+  }
+
+  //Slot of the index-th live particle, for index below count().
+  uint16_t slot(uint16_t index) const
+  {
+    return live_slots[index];
+  }
+
+  static constexpr uint16_t capacity()
+  {
+    return Capacity;
+  }
+
+private:
+  uint16_t live_slots[Capacity];
+  uint16_t free_slots[Capacity];
+  uint16_t live_count;
+  uint16_t free_count;
+};
+
+#endif
@@ -0,0 +1,62 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  rng.cpp
+  Seeding of the random number streams in rng.h.
+*/
+
+#include "rng.h"
+
+static uint32_t Rng_Seed;
+static uint32_t Rng_Generation;
+
+void rngBegin(uint32_t seed)
+{
+  Rng_Seed = seed;
+  Rng_Generation++;
+}
+
+void rngStream(struct rng_s *rng, const char *name)
+{
+  if(rng->generation == Rng_Generation && rng->state != 0)
+  {
+    return;
+  }
+
+  //FNV-1a over the name, with the seed mixed in and the MurmurHash3 finalizer on top, so neighbouring seeds give unrelated streams
+  uint32_t hash = 2166136261u;
+  for(; *name; name++)
+  {
+    hash = (hash ^ (uint8_t)*name) * 16777619u;
+  }
+  hash ^= Rng_Seed * 0x9E3779B9u;
+  hash ^= hash >> 16;
+  hash *= 0x85EBCA6Bu;
+  hash ^= hash >> 13;
+  hash *= 0xC2B2AE35u;
+  hash ^= hash >> 16;
+  rng->state = hash ? hash : 0x6D2B79F5u;
+  rng->generation = Rng_Generation;
+}
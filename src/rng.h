@@ -0,0 +1,72 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  rng.h
+  Random number streams for the effects. Each effect draws from its own
+  xorshift32 stream, seeded from the seed setup() picks and the effect's
+  name, so what one effect draws doesn't depend on what the others drew
+  before it, and a run can be replayed from its seed alone. A draw is three
+  shifts and three XORs, and ranges are mapped with one 32x32->64 bit
+  multiply (a single UMULL on the Cortex-M4) rather than the divisions
+  random() makes.
+*/
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <Arduino.h>
+
+struct rng_s
+{
+  uint32_t state; // Never 0 once seeded
+  uint32_t generation; // The rngBegin() call the stream was seeded after
+};
+
+void rngBegin(uint32_t seed); // Sets the seed every stream derives from. Streams restart from it at their next rngStream()
+void rngStream(struct rng_s *rng, const char *name); // Seeds the named stream, unless it already is for the current seed
+
+static inline uint32_t rngNext(struct rng_s *rng)
+{
+  uint32_t x = rng->state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  rng->state = x;
+  return x;
+}
+
+//A number from 0 to count - 1. Unless count is a power of two, some values are more likely, by at most count in 2^32.
+static inline uint32_t rngBelow(struct rng_s *rng, uint32_t count)
+{
+  return (uint32_t)(((uint64_t)rngNext(rng) * count) >> 32);
+}
+
+//A number from low to high, both included
+static inline int32_t rngBetween(struct rng_s *rng, int32_t low, int32_t high)
+{
+  return low + (int32_t)rngBelow(rng, (uint32_t)(high - low) + 1);
+}
+
+#endif
@@ -0,0 +1,110 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  strand.h
+  The shape of the installation as one type. StrandGeometry takes the strand
+  length, the number of OctoWS2811 outputs it is cut into, the OctoWS2811
+  config (color order and speed) and which segments are wired from their far
+  end, and turns them into constants: LEDs per output, the DMA buffer size,
+  where each segment starts and which way it runs, and the byte order on the
+  wire. Buffers are sized from these and loops run to them, so every count
+  is known to the compiler.
+
+  Strand is the installation config.h describes. Another installation is
+  another set of STRAND_ values, e.g. from a platformio.ini environment.
+*/
+
+#ifndef STRAND_H
+#define STRAND_H
+
+#include <Arduino.h>
+#include <OctoWS2811.h>
+#include "config.h"
+
+#define OCTO_STRIPS  8
+
+template <uint32_t Leds, uint32_t Segments, uint32_t Config, uint32_t Reversed = 0>
+struct StrandGeometry
+{
+  static_assert(Leds > 0, "The strand needs at least one LED");
+  static_assert(Segments >= 1 && Segments <= OCTO_STRIPS, "STRAND_SEGMENTS must be between 1 and 8");
+
+  static constexpr uint32_t leds = Leds;
+  static constexpr uint32_t segments = Segments;
+  static constexpr uint32_t config = Config;
+  static constexpr uint32_t color_order = Config & 7;
+  static constexpr uint32_t leds_per_channel = (Leds + Segments - 1) / Segments; // Every segment but the last is this long
+  static constexpr uint32_t framebuffer_words = leds_per_channel * 6; // OctoWS2811's DMA buffer: 24 bits of all 8 outputs per LED
+
+  //Segment N covers strand LEDs N * leds_per_channel onwards. The last one may be shorter, and outputs past Segments have none.
+  static constexpr uint32_t segmentLength(uint32_t segment)
+  {
+    return segment >= Segments || segment * leds_per_channel >= Leds ? 0 :
+      (Leds - segment * leds_per_channel < leds_per_channel ? Leds - segment * leds_per_channel : leds_per_channel);
+  }
+
+  static constexpr bool segmentReversed(uint32_t segment)
+  {
+    return (Reversed >> segment) & 1;
+  }
+
+  //The strand LED at a segment's output offset is origin + step * offset.
+  static constexpr int32_t segmentOrigin(uint32_t segment)
+  {
+    return segment * leds_per_channel + (segmentReversed(segment) && segmentLength(segment) ? segmentLength(segment) - 1 : 0);
+  }
+
+  static constexpr int32_t segmentStep(uint32_t segment)
+  {
+    return segmentReversed(segment) ? -1 : 1;
+  }
+
+  /*
+    Reorders a 0xRRGGBB color into the order the LEDs expect on the wire.
+    The first byte sent ends up in bits 16-23.
+  */
+  static inline uint32_t wireOrder(uint32_t color)
+  {
+    switch(color_order)
+    {
+      case WS2811_RBG:
+        return (color & 0xFF0000) | ((color << 8) & 0x00FF00) | ((color >> 8) & 0x0000FF);
+      case WS2811_GRB:
+        return ((color << 8) & 0xFF0000) | ((color >> 8) & 0x00FF00) | (color & 0x0000FF);
+      case WS2811_GBR:
+        return ((color << 8) & 0xFFFF00) | ((color >> 16) & 0x0000FF);
+      case WS2811_BRG:
+        return ((color << 16) & 0xFF0000) | ((color >> 8) & 0x00FFFF);
+      case WS2811_BGR:
+        return ((color << 16) & 0xFF0000) | (color & 0x00FF00) | ((color >> 16) & 0x0000FF);
+      default:
+        return color;
+    }
+  }
+};
+
+typedef StrandGeometry<STRAND_LENGTH, STRAND_SEGMENTS, OCTO_CONFIG, STRAND_REVERSED_SEGMENTS> Strand;
+
+#endif
@@ -0,0 +1,352 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  telemetry.cpp
+  Stage timing, statistics and the non-blocking serial dump.
+*/
+
+#include <stdio.h>
+#include "config.h"
+#include "telemetry.h"
+
+#if defined(__arm__) && defined(ARM_DWT_CYCCNT)
+#define TELEMETRY_TICKS_PER_US  (F_CPU / 1000000)
+#else
+#include <time.h>
+#define TELEMETRY_TICKS_PER_US  1000
+#endif
+
+//Room for the longest dump line: an F line of eight 10 digit numbers with the effect, spaces and \r\n comes to 84 characters.
+#define TELEMETRY_LINE_LENGTH 96
+#define TELEMETRY_BUCKETS_PER_LINE 5
+
+static const char * const Stage_Names[TELEMETRY_STAGES] = {"update", "clear", "render", "wait", "encode", "show"};
+
+struct telemetry_effect_stats_s TelemetryEffects[TELEMETRY_MAX_EFFECTS];
+struct telemetry_stream_stats_s TelemetryStream;
+
+static struct telemetry_frame_s Ring[TELEMETRY_RING_SIZE];
+static uint32_t Ring_Head = 0; // Index the next frame is written to
+static uint32_t Ring_Count = 0;
+static struct telemetry_frame_s Current_Frame;
+static uint32_t Lap_Start = 0;
+
+/*
+  A dump walks through the effect stage lines, then the power lines, then
+  the stream line, then the histograms, then the ring. Dump_Line is the position within that sequence, or -1 when idle.
+*/
+static int32_t Dump_Line = -1;
+//availableForWrite() never reports more than one 64 byte USB packet, so a line can go out over two calls to telemetryService()
+static char Dump_Text[TELEMETRY_LINE_LENGTH];
+static int Dump_Length = 0; // Bytes of Dump_Text still to send, starting Dump_Sent bytes in
+static int Dump_Sent = 0;
+
+void telemetryBegin()
+{
+#if defined(__arm__) && defined(ARM_DWT_CYCCNT)
+  ARM_DEMCR |= ARM_DEMCR_TRCENA;
+  ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+#endif
+  telemetryReset();
+}
+
+uint32_t telemetryTicks()
+{
+#if defined(__arm__) && defined(ARM_DWT_CYCCNT)
+  return ARM_DWT_CYCCNT;
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((uint64_t)now.tv_sec * 1000000000ull + now.tv_nsec);
+#endif
+}
+
+uint32_t telemetryTicksToNanos(uint32_t ticks)
+{
+  return (uint64_t)ticks * 1000 / TELEMETRY_TICKS_PER_US;
+}
+
+void telemetryReset()
+{
+  memset(TelemetryEffects, 0, sizeof(TelemetryEffects));
+  for(int effect = 0; effect < TELEMETRY_MAX_EFFECTS; effect++)
+  {
+    for(int stage = 0; stage < TELEMETRY_STAGES; stage++)
+    {
+      TelemetryEffects[effect].stages[stage].min = 0xFFFFFFFF;
+    }
+  }
+  memset(&TelemetryStream, 0, sizeof(TelemetryStream));
+  TelemetryStream.min_latency_us = 0xFFFFFFFF;
+  Ring_Head = 0;
+  Ring_Count = 0;
+}
+
+void telemetryBeginFrame(uint32_t frame, uint32_t effect)
+{
+  memset(&Current_Frame, 0, sizeof(Current_Frame));
+  Current_Frame.frame = frame;
+  Current_Frame.effect = effect < TELEMETRY_MAX_EFFECTS ? effect : TELEMETRY_MAX_EFFECTS - 1;
+  Lap_Start = telemetryTicks();
+}
+
+void telemetryLap(enum telemetry_stage_e stage)
+{
+  uint32_t now = telemetryTicks();
+  Current_Frame.ticks[stage] += now - Lap_Start;
+  Lap_Start = now;
+}
+
+void telemetryPower(uint32_t milliamps, bool limited)
+{
+  struct telemetry_power_stats_s *power = &TelemetryEffects[Current_Frame.effect].power;
+  if(milliamps > power->max_milliamps)
+  {
+    power->max_milliamps = milliamps;
+  }
+  power->total_milliamps += milliamps;
+  power->frames++;
+  power->limited_frames += limited;
+}
+
+void telemetryStreamFrame(uint32_t latency_us)
+{
+  if(latency_us < TelemetryStream.min_latency_us)
+  {
+    TelemetryStream.min_latency_us = latency_us;
+  }
+  if(latency_us > TelemetryStream.max_latency_us)
+  {
+    TelemetryStream.max_latency_us = latency_us;
+  }
+  TelemetryStream.total_latency_us += latency_us;
+  TelemetryStream.frames++;
+}
+
+void telemetryStreamDropped()
+{
+  TelemetryStream.dropped++;
+}
+
+void telemetryEndFrame()
+{
+  struct telemetry_effect_stats_s *stats = &TelemetryEffects[Current_Frame.effect];
+  uint32_t frame_ticks = 0;
+  for(int stage = 0; stage < TELEMETRY_STAGES; stage++)
+  {
+    uint32_t ticks = Current_Frame.ticks[stage];
+    struct telemetry_stage_stats_s *stage_stats = &stats->stages[stage];
+    if(ticks < stage_stats->min)
+    {
+      stage_stats->min = ticks;
+    }
+    if(ticks > stage_stats->max)
+    {
+      stage_stats->max = ticks;
+    }
+    stage_stats->total += ticks;
+    stage_stats->count++;
+    if(stage != TELEMETRY_WAIT)
+    {
+      frame_ticks += ticks; //The histogram shows the time the frame kept the CPU busy
+    }
+  }
+
+  const uint32_t budget = FRAME_PERIOD_US * TELEMETRY_TICKS_PER_US;
+  uint32_t bucket = (uint64_t)frame_ticks * (TELEMETRY_HISTOGRAM_BUCKETS - 1) / budget;
+  stats->histogram[bucket < TELEMETRY_HISTOGRAM_BUCKETS ? bucket : TELEMETRY_HISTOGRAM_BUCKETS - 1]++;
+
+  Ring[Ring_Head] = Current_Frame;
+  Ring_Head = (Ring_Head + 1) % TELEMETRY_RING_SIZE;
+  if(Ring_Count < TELEMETRY_RING_SIZE)
+  {
+    Ring_Count++;
+  }
+}
+
+/*
+  Formats dump line number `line` into `out`. Returns its length, -1 if there
+  is nothing to send for that line, or 0 once the dump is complete.
+*/
+static int formatDumpLine(int32_t line, char *out)
+{
+  const int32_t stage_lines = TELEMETRY_MAX_EFFECTS * TELEMETRY_STAGES;
+  const int32_t power_lines = TELEMETRY_MAX_EFFECTS;
+  const int32_t lines_per_histogram = (TELEMETRY_HISTOGRAM_BUCKETS + TELEMETRY_BUCKETS_PER_LINE - 1) / TELEMETRY_BUCKETS_PER_LINE;
+  const int32_t histogram_lines = TELEMETRY_MAX_EFFECTS * lines_per_histogram;
+
+  if(line == 0)
+  {
+    return snprintf(out, TELEMETRY_LINE_LENGTH, "# S effect stage min avg max (ns)\r\n");
+  }
+  if(line == 1)
+  {
+    return snprintf(out, TELEMETRY_LINE_LENGTH, "# H effect first_bucket counts (1/%d frame)\r\n",
+      TELEMETRY_HISTOGRAM_BUCKETS - 1);
+  }
+  if(line == 2)
+  {
+    return snprintf(out, TELEMETRY_LINE_LENGTH, "# F frame effect update clear render wait encode show (ns)\r\n");
+  }
+  if(line == 3)
+  {
+    return snprintf(out, TELEMETRY_LINE_LENGTH, "# P effect avg max (mA) limited_frames\r\n");
+  }
+  if(line == 4)
+  {
+    return snprintf(out, TELEMETRY_LINE_LENGTH, "# A frames dropped latency min avg max (us)\r\n");
+  }
+  line -= 5;
+
+  if(line < stage_lines)
+  {
+    int effect = line / TELEMETRY_STAGES;
+    int stage = line % TELEMETRY_STAGES;
+    struct telemetry_stage_stats_s *stats = &TelemetryEffects[effect].stages[stage];
+    if(stats->count == 0)
+    {
+      return -1;
+    }
+    return snprintf(out, TELEMETRY_LINE_LENGTH, "S %d %s %lu %lu %lu\r\n", effect, Stage_Names[stage],
+      (unsigned long)telemetryTicksToNanos(stats->min),
+      (unsigned long)telemetryTicksToNanos((uint32_t)(stats->total / stats->count)),
+      (unsigned long)telemetryTicksToNanos(stats->max));
+  }
+  line -= stage_lines;
+
+  if(line < power_lines)
+  {
+    struct telemetry_power_stats_s *power = &TelemetryEffects[line].power;
+    if(power->frames == 0)
+    {
+      return -1;
+    }
+    return snprintf(out, TELEMETRY_LINE_LENGTH, "P %d %lu %lu %lu\r\n", (int)line,
+      (unsigned long)(power->total_milliamps / power->frames),
+      (unsigned long)power->max_milliamps,
+      (unsigned long)power->limited_frames);
+  }
+  line -= power_lines;
+
+  if(line == 0)
+  {
+    if(TelemetryStream.frames == 0 && TelemetryStream.dropped == 0)
+    {
+      return -1;
+    }
+    return snprintf(out, TELEMETRY_LINE_LENGTH, "A %lu %lu %lu %lu %lu\r\n",
+      (unsigned long)TelemetryStream.frames,
+      (unsigned long)TelemetryStream.dropped,
+      (unsigned long)(TelemetryStream.frames ? TelemetryStream.min_latency_us : 0),
+      (unsigned long)(TelemetryStream.frames ? TelemetryStream.total_latency_us / TelemetryStream.frames : 0),
+      (unsigned long)TelemetryStream.max_latency_us);
+  }
+  line -= 1;
+
+  if(line < histogram_lines)
+  {
+    int effect = line / lines_per_histogram;
+    int first_bucket = (line % lines_per_histogram) * TELEMETRY_BUCKETS_PER_LINE;
+    if(TelemetryEffects[effect].stages[TELEMETRY_UPDATE].count == 0)
+    {
+      return -1;
+    }
+    int length = snprintf(out, TELEMETRY_LINE_LENGTH, "H %d %d", effect, first_bucket);
+    for(int bucket = first_bucket; bucket < first_bucket + TELEMETRY_BUCKETS_PER_LINE && bucket < TELEMETRY_HISTOGRAM_BUCKETS; bucket++)
+    {
+      length += snprintf(out + length, TELEMETRY_LINE_LENGTH - length, " %lu", (unsigned long)TelemetryEffects[effect].histogram[bucket]);
+    }
+    return length + snprintf(out + length, TELEMETRY_LINE_LENGTH - length, "\r\n");
+  }
+  line -= histogram_lines;
+
+  if(line < (int32_t)Ring_Count)
+  {
+    struct telemetry_frame_s *frame = &Ring[(Ring_Head + TELEMETRY_RING_SIZE - Ring_Count + line) % TELEMETRY_RING_SIZE];
+    return snprintf(out, TELEMETRY_LINE_LENGTH, "F %lu %u %lu %lu %lu %lu %lu %lu\r\n", (unsigned long)frame->frame, frame->effect,
+      (unsigned long)telemetryTicksToNanos(frame->ticks[TELEMETRY_UPDATE]),
+      (unsigned long)telemetryTicksToNanos(frame->ticks[TELEMETRY_CLEAR]),
+      (unsigned long)telemetryTicksToNanos(frame->ticks[TELEMETRY_RENDER]),
+      (unsigned long)telemetryTicksToNanos(frame->ticks[TELEMETRY_WAIT]),
+      (unsigned long)telemetryTicksToNanos(frame->ticks[TELEMETRY_ENCODE]),
+      (unsigned long)telemetryTicksToNanos(frame->ticks[TELEMETRY_SHOW]));
+  }
+  return 0;
+}
+
+void telemetryCommand(int command)
+{
+  if(command == 't' && Dump_Line < 0)
+  {
+    Dump_Line = 0;
+  }
+  else if(command == 'r')
+  {
+    telemetryReset();
+  }
+}
+
+void telemetryReadCommands()
+{
+  while(Serial.available() > 0)
+  {
+    telemetryCommand(Serial.read());
+  }
+}
+
+void telemetryService()
+{
+  if(Dump_Line < 0)
+  {
+    return;
+  }
+
+  if(Dump_Length == 0)
+  {
+    int length = formatDumpLine(Dump_Line, Dump_Text);
+    if(length == 0)
+    {
+      Dump_Line = -1;
+      return;
+    }
+    Dump_Line++;
+    if(length < 0 || length >= TELEMETRY_LINE_LENGTH)
+    {
+      return; //Nothing to send, or a line snprintf() had to cut short, which is skipped rather than sent without its \r\n
+    }
+    Dump_Length = length;
+    Dump_Sent = 0;
+  }
+
+  int room = Serial.availableForWrite();
+  int count = Dump_Length < room ? Dump_Length : room;
+  if(count <= 0)
+  {
+    return; //Try again once the USB packet has gone out
+  }
+  Serial.write((const uint8_t *)Dump_Text + Dump_Sent, count);
+  Dump_Sent += count;
+  Dump_Length -= count;
+}
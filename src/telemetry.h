@@ -0,0 +1,120 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  telemetry.h
+  Per-stage frame timing. Each frame is split into the stages below and timed
+  with the Cortex-M4 DWT cycle counter (a monotonic clock in the native build).
+  Running min/avg/max per stage, a histogram of whole-frame times, and the
+  estimated current of the frames sent are kept for every effect, along with the last TELEMETRY_RING_SIZE frames. Frames
+  the effect didn't change end after the update stage and count as taking no
+  time in the rest.
+
+  Sending 't' over the USB serial port dumps all of it, one line per call to
+  telemetryService() and only when the line fits in the USB transmit buffer,
+  so a dump never holds up a frame. 'r' clears the statistics. While an
+  effect that reads the serial port itself is active (see service in
+  effect.h), it hands the commands on with telemetryCommand().
+*/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+enum telemetry_stage_e
+{
+  TELEMETRY_UPDATE,
+  TELEMETRY_CLEAR,
+  TELEMETRY_RENDER,
+  TELEMETRY_WAIT, // From the end of drawing until the strand has latched the last frame
+  TELEMETRY_ENCODE,
+  TELEMETRY_SHOW,
+  TELEMETRY_STAGES
+};
+
+#define TELEMETRY_MAX_EFFECTS 8
+#define TELEMETRY_RING_SIZE   64
+//Whole-frame times are bucketed in eighths of the frame period. The last bucket holds overruns.
+#define TELEMETRY_HISTOGRAM_BUCKETS 9
+
+struct telemetry_stage_stats_s
+{
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;
+  uint32_t count;
+};
+
+struct telemetry_power_stats_s
+{
+  uint32_t max_milliamps;
+  uint64_t total_milliamps;
+  uint32_t frames; // Frames encoded
+  uint32_t limited_frames; // Frames the power limiter dimmed
+};
+
+struct telemetry_effect_stats_s
+{
+  struct telemetry_stage_stats_s stages[TELEMETRY_STAGES];
+  uint32_t histogram[TELEMETRY_HISTOGRAM_BUCKETS];
+  struct telemetry_power_stats_s power;
+};
+
+struct telemetry_stream_stats_s
+{
+  uint32_t frames; // Streamed frames received whole and handed to the encoder
+  uint32_t dropped; // Streamed frames given up on, for a bad header or stalling partway
+  uint32_t min_latency_us; // From a frame's header arriving to the frame being handed to the encoder
+  uint32_t max_latency_us;
+  uint64_t total_latency_us;
+};
+
+struct telemetry_frame_s
+{
+  uint32_t frame;
+  uint8_t effect;
+  uint32_t ticks[TELEMETRY_STAGES];
+};
+
+void telemetryBegin();
+uint32_t telemetryTicks();
+uint32_t telemetryTicksToNanos(uint32_t ticks);
+
+void telemetryBeginFrame(uint32_t frame, uint32_t effect); // Starts timing a frame's first stage
+void telemetryLap(enum telemetry_stage_e stage); // Ends a stage and starts the next
+void telemetryPower(uint32_t milliamps, bool limited); // Records the estimated current of the frame being sent
+void telemetryEndFrame();
+void telemetryStreamFrame(uint32_t latency_us); // Records a streamed frame handed to the encoder
+void telemetryStreamDropped(); // Records a streamed frame that was given up on
+
+void telemetryReset();
+void telemetryCommand(int command); // Acts on one command byte read from the serial port
+void telemetryReadCommands(); // Reads and acts on the commands waiting on the serial port
+void telemetryService(); // Sends the next line of a dump
+
+extern struct telemetry_effect_stats_s TelemetryEffects[TELEMETRY_MAX_EFFECTS];
+extern struct telemetry_stream_stats_s TelemetryStream;
+
+#endif
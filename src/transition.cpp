@@ -0,0 +1,96 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  transition.cpp
+  The transition styles of config.h, each writing a whole strand of mixed
+  pixels per call.
+*/
+
+#include "blend.h"
+#include "config.h"
+#include "frame.h"
+#include "transition.h"
+
+#define TRANSITION_WIPE_EDGE      8 //LEDs over which the wipe's edge fades from one effect to the other
+#define TRANSITION_DISSOLVE_FADE  (TRANSITION_PROGRESS_ONE / 8) //Progress over which each LED fades across
+
+static void crossfade(uint32_t *out, const uint32_t *from, const uint32_t *to, uint32_t progress)
+{
+  uint32_t alpha = progress >> (TRANSITION_PROGRESS_SHIFT - 8);
+  for(int led = 0; led < FRAME_PIXELS; led++)
+  {
+    out[led] = blendAlpha(from[led], to[led], alpha);
+  }
+}
+
+/*
+  The edge starts TRANSITION_WIPE_EDGE LEDs before the strand and ends on its
+  last LED. LEDs it has passed show to, LEDs ahead of it show from, and only
+  the LEDs on it are blended.
+*/
+static void wipe(uint32_t *out, const uint32_t *from, const uint32_t *to, uint32_t progress)
+{
+  int32_t edge = (int32_t)(((uint64_t)progress * (FRAME_PIXELS + TRANSITION_WIPE_EDGE)) >> TRANSITION_PROGRESS_SHIFT) - TRANSITION_WIPE_EDGE;
+  int32_t edge_end = edge + TRANSITION_WIPE_EDGE;
+  int32_t passed = edge > 0 ? edge : 0;
+  int32_t ahead = edge_end < FRAME_PIXELS ? edge_end : FRAME_PIXELS;
+  memcpy(out, to, passed * sizeof(out[0]));
+  for(int32_t led = passed; led < ahead; led++)
+  {
+    out[led] = blendAlpha(from[led], to[led], (edge_end - led) * 256 / TRANSITION_WIPE_EDGE);
+  }
+  memcpy(out + ahead, from + ahead, (FRAME_PIXELS - ahead) * sizeof(out[0]));
+}
+
+/*
+  Each LED starts fading at its own point of the transition, picked by
+  hashing its index, and takes TRANSITION_DISSOLVE_FADE to get across.
+*/
+static void dissolve(uint32_t *out, const uint32_t *from, const uint32_t *to, uint32_t progress)
+{
+  const uint32_t span = TRANSITION_PROGRESS_ONE - TRANSITION_DISSOLVE_FADE;
+  for(int led = 0; led < FRAME_PIXELS; led++)
+  {
+    uint32_t start = (((uint32_t)led * 2654435761u) >> 16) * span >> 16; //Knuth's multiplicative hash, scaled onto the starting points
+    uint32_t alpha = progress <= start ? 0 : (progress - start) * 256 / TRANSITION_DISSOLVE_FADE;
+    out[led] = blendAlpha(from[led], to[led], alpha < 256 ? alpha : 256);
+  }
+}
+
+void transitionMix(uint32_t style, uint32_t *out, const uint32_t *from, const uint32_t *to, uint32_t progress)
+{
+  switch(style)
+  {
+    case TRANSITION_WIPE:
+      wipe(out, from, to, progress);
+      break;
+    case TRANSITION_DISSOLVE:
+      dissolve(out, from, to, progress);
+      break;
+    default:
+      crossfade(out, from, to, progress);
+      break;
+  }
+}
@@ -0,0 +1,42 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  transition.h
+  Mixes the outgoing and incoming effects' frames during a transition.
+  progress runs from 0 (all from) to TRANSITION_PROGRESS_ONE (all to), and
+  every style is integer math on top of blendAlpha().
+*/
+
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include <Arduino.h>
+
+#define TRANSITION_PROGRESS_SHIFT 16
+#define TRANSITION_PROGRESS_ONE   (1u << TRANSITION_PROGRESS_SHIFT)
+
+void transitionMix(uint32_t style, uint32_t *out, const uint32_t *from, const uint32_t *to, uint32_t progress); // style is one of the TRANSITION_ styles in config.h
+
+#endif
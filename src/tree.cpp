@@ -0,0 +1,184 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  tree.cpp
+  The per-LED coordinate table, built by the compiler, and the band and
+  sector lookups on top of it.
+*/
+
+#include "tree.h"
+
+//The ring an LED is on, searched from ring upwards
+constexpr uint32_t treeRingOf(uint32_t led, uint32_t ring = 0)
+{
+  return ring + 1 >= TREE_RINGS || led < treeRingStart(ring + 1) ? ring : treeRingOf(led, ring + 1);
+}
+
+//The spiral climbs one ring height per turn, so an LED part of the way around its ring is that much higher.
+constexpr uint16_t treeHeight(uint32_t ring, uint32_t offset)
+{
+  return ((uint64_t)(ring * treeRingSize(ring) + offset) << 16) / (TREE_RINGS * treeRingSize(ring));
+}
+
+constexpr uint16_t treeAngle(uint32_t ring, uint32_t offset)
+{
+  return ((uint64_t)offset << 16) / treeRingSize(ring);
+}
+
+//The radius narrows from this ring's towards the next one's on the way around. Ring sizes stand in for circumferences.
+constexpr uint32_t treeRadiusOf(uint32_t ring, uint32_t offset)
+{
+  return (((int64_t)treeRingSize(ring) * treeRingSize(ring) +
+    ((int64_t)treeRingSize(ring + 1 < TREE_RINGS ? ring + 1 : ring) - treeRingSize(ring)) * offset) << 16) /
+    ((int64_t)treeRingSize(ring) * treeRingSize(0));
+}
+
+constexpr uint16_t treeRadius(uint32_t ring, uint32_t offset)
+{
+  return treeRadiusOf(ring, offset) > 0xFFFF ? 0xFFFF : treeRadiusOf(ring, offset);
+}
+
+constexpr struct tree_point_s treePoint(uint32_t led)
+{
+  return {treeHeight(treeRingOf(led), led - treeRingStart(treeRingOf(led))),
+    treeAngle(treeRingOf(led), led - treeRingStart(treeRingOf(led))),
+    treeRadius(treeRingOf(led), led - treeRingStart(treeRingOf(led)))};
+}
+
+/*
+  0 to N - 1 as a template parameter pack, built by halves so the template
+  nesting stays at log2(N) for strands of thousands of LEDs.
+*/
+template <uint32_t... Index>
+struct TreeIndices
+{
+  typedef TreeIndices type;
+};
+
+template <class Low, class High>
+struct TreeJoin;
+
+template <uint32_t... Low, uint32_t... High>
+struct TreeJoin<TreeIndices<Low...>, TreeIndices<High...>> : TreeIndices<Low..., (sizeof...(Low) + High)...> {};
+
+template <uint32_t Count>
+struct TreeSequence : TreeJoin<typename TreeSequence<Count / 2>::type, typename TreeSequence<Count - Count / 2>::type> {};
+
+template <>
+struct TreeSequence<0> : TreeIndices<> {};
+
+template <>
+struct TreeSequence<1> : TreeIndices<0> {};
+
+template <uint32_t... Index>
+constexpr struct tree_table_s treeTable(TreeIndices<Index...>)
+{
+  return {{treePoint(Index)...}};
+}
+
+//Declared extern in tree.h, so this is the one copy, in flash
+constexpr struct tree_table_s Tree_Table = treeTable(TreeSequence<FRAME_PIXELS>::type());
+
+static_assert(Tree_Table.points[0].height == 0 && Tree_Table.points[0].angle == 0, "The strand starts at the bottom of the tree");
+static_assert(Tree_Table.points[treeRingStart(1)].angle == 0, "Each ring starts back at the strand's starting angle");
+
+uint32_t treeRing(int led)
+{
+  uint32_t ring = 0;
+  while(ring + 1 < TREE_RINGS && (uint32_t)led >= treeRingStart(ring + 1))
+  {
+    ring++;
+  }
+  return ring;
+}
+
+//The first LED at least height high, or FRAME_PIXELS
+static uint32_t treeFirstAtHeight(uint16_t height)
+{
+  uint32_t low = 0, high = FRAME_PIXELS;
+  while(low < high)
+  {
+    uint32_t middle = (low + high) / 2;
+    if(Tree_Table.points[middle].height < height)
+    {
+      low = middle + 1;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+bool treeHeightRange(uint16_t low, uint16_t high, struct tree_range_s *range)
+{
+  uint32_t first = treeFirstAtHeight(low);
+  uint32_t end = low < high ? treeFirstAtHeight(high) : first;
+  if(end <= first)
+  {
+    return false;
+  }
+  range->first = first;
+  range->last = end - 1;
+  return true;
+}
+
+//The first offset in a ring of size LEDs whose angle is at least angle (out of 65536)
+static inline uint32_t treeOffsetAtAngle(uint32_t size, uint32_t angle)
+{
+  return (angle * size + 0xFFFF) >> 16;
+}
+
+/*
+  Within a ring an LED's angle is offset / size of a turn, so the LEDs of a
+  sector are found with one multiply per edge, not by visiting them.
+*/
+uint32_t treeSectorRanges(uint16_t start, uint16_t width, struct tree_range_s *ranges)
+{
+  uint32_t count = 0;
+  uint32_t end = (uint32_t)start + width; //Up to 2 turns; past 65536 the sector wraps to the strand's starting angle
+  for(uint32_t ring = 0; ring < TREE_RINGS; ring++)
+  {
+    uint32_t ring_start = treeRingStart(ring);
+    uint32_t size = treeRingSize(ring);
+    uint32_t first = treeOffsetAtAngle(size, start);
+    uint32_t last = end > 0x10000 ? size : treeOffsetAtAngle(size, end);
+    if(first < last)
+    {
+      ranges[count].first = ring_start + first;
+      ranges[count].last = ring_start + last - 1;
+      count++;
+    }
+    uint32_t wrapped = end > 0x10000 ? treeOffsetAtAngle(size, end - 0x10000) : 0;
+    if(wrapped > 0)
+    {
+      ranges[count].first = ring_start;
+      ranges[count].last = ring_start + (wrapped < first ? wrapped : first) - 1;
+      count++;
+    }
+  }
+  return count;
+}
@@ -0,0 +1,101 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  tree.h
+  Where each LED sits on the tree. The strand spirals up from the bottom in
+  rings that shrink towards the top, described by TREE_RING_SIZES in
+  config.h and scaled onto however many LEDs the strand has. From that the
+  compiler works out, for every LED, its height, its angle around the trunk
+  and its distance from it, and stores them in flash as Tree_Table. An
+  effect that sweeps, rotates or spirals reads those instead of doing
+  trigonometry.
+
+  Every coordinate is an unsigned 16 bit fraction: height from 0 at the
+  bottom towards 1 at the top, angle in turns from the strand's start
+  (wrapping around like any uint16_t), and radius relative to the bottom
+  ring. The same bits are a Q16.16 fraction, so (fixed_t)point.height can go
+  straight into fixed.h math.
+
+  Height only grows along the strand, so a height band is one run of LEDs,
+  and an angle sector is one run per ring (two where it wraps past the
+  start). The range helpers hand those runs out ready for frameSpan().
+*/
+
+#ifndef TREE_H
+#define TREE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "frame.h"
+
+constexpr uint16_t Tree_Ring_Sizes[] = TREE_RING_SIZES;
+
+#define TREE_RINGS (sizeof(Tree_Ring_Sizes) / sizeof(Tree_Ring_Sizes[0]))
+#define TREE_MAX_SECTOR_RANGES (TREE_RINGS * 2)
+
+struct tree_point_s
+{
+  uint16_t height;
+  uint16_t angle;
+  uint16_t radius;
+};
+
+struct tree_table_s
+{
+  struct tree_point_s points[FRAME_PIXELS];
+};
+
+//A run of LEDs, first to last inclusive, as frameSpan() takes them
+struct tree_range_s
+{
+  uint16_t first;
+  uint16_t last;
+};
+
+constexpr uint32_t treeRingPrefix(uint32_t ring)
+{
+  return ring == 0 ? 0 : treeRingPrefix(ring - 1) + Tree_Ring_Sizes[ring - 1];
+}
+
+//The described rings are stretched over the whole strand, so each starts at the same fraction of it as in TREE_RING_SIZES.
+constexpr uint32_t treeRingStart(uint32_t ring)
+{
+  return (uint64_t)treeRingPrefix(ring) * FRAME_PIXELS / treeRingPrefix(TREE_RINGS);
+}
+
+constexpr uint32_t treeRingSize(uint32_t ring)
+{
+  return treeRingStart(ring + 1) - treeRingStart(ring);
+}
+
+static_assert(FRAME_PIXELS >= treeRingPrefix(TREE_RINGS), "TREE_RING_SIZES describes more LEDs than the strand has");
+
+extern const struct tree_table_s Tree_Table;
+
+uint32_t treeRing(int led);
+bool treeHeightRange(uint16_t low, uint16_t high, struct tree_range_s *range); // LEDs with low <= height < high. False if there are none
+uint32_t treeSectorRanges(uint16_t start, uint16_t width, struct tree_range_s *ranges); // LEDs with an angle within width after start, into up to TREE_MAX_SECTOR_RANGES ranges. Returns how many
+
+#endif
@@ -0,0 +1,70 @@
+/*
+MIT License
+
+Copyright (c) 2020 Chase Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  wire_timing.h
+  How long OctoWS2811 takes to send a frame. All eight outputs are clocked
+  out in parallel by DMA, so the time depends only on the LEDs per output:
+  24 bits each at the bit rate OCTO_CONFIG picks, then the reset gap the
+  library leaves before the next show() can start, during which busy() is
+  still set. That gap is 300 us for every strand type, the WS2813's reset
+  time, although a WS2811 latches after 50 us.
+
+  Everything is constexpr, so the firmware can refuse a configuration that
+  can't send TARGET_FPS frames, and the native build's fake OctoWS2811 and
+  "timing" command use the same numbers.
+*/
+
+#ifndef WIRE_TIMING_H
+#define WIRE_TIMING_H
+
+#include <OctoWS2811.h>
+
+#define WIRE_BITS_PER_LED 24
+#define WIRE_LATCH_US     300
+#define WIRE_SPEED_MASK   0xF0 // The bits of an OctoWS2811 config that pick the strand type
+
+constexpr uint32_t wireBitNs(uint32_t config)
+{
+  return (config & WIRE_SPEED_MASK) == WS2811_400kHz ? 2500 : 1250;
+}
+
+//The DMA transfer alone, rounded up to a whole microsecond
+constexpr uint32_t wireTransferUs(uint32_t leds_per_channel, uint32_t config)
+{
+  return (leds_per_channel * WIRE_BITS_PER_LED * wireBitNs(config) + 999) / 1000;
+}
+
+//From show() to the end of busy(): the shortest time between two frames
+constexpr uint32_t wireFrameUs(uint32_t leds_per_channel, uint32_t config)
+{
+  return wireTransferUs(leds_per_channel, config) + WIRE_LATCH_US;
+}
+
+constexpr uint32_t wireMaxFps(uint32_t leds_per_channel, uint32_t config)
+{
+  return 1000000 / wireFrameUs(leds_per_channel, config);
+}
+
+#endif